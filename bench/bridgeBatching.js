@@ -0,0 +1,82 @@
+#!/usr/bin/env node
+"use strict";
+
+// Round-trips and latency of a document assembly flow through ActionUtils.exec, sent call by call and through kutExecBatch.
+// Every round-trip to the native stand-in costs a fixed latency, standing in for the serialization and thread hops of the bridge.
+//
+// usage: node bench/bridgeBatching.js [pages] [latencyMs]
+
+let standIn = require("../test/support/nativeStandIn");
+
+let pages = parseInt(process.argv[2], 10) || 20;
+let latencyMs = process.argv[3] === undefined ? 1 : parseFloat(process.argv[3]);
+let flowActions = [
+	"kloCreatePageObject",
+	"kedSetImageProperties",
+	"kloAddImageToPage",
+	"kloAddPageToDocument",
+	"kloUpdateFields",
+];
+
+function setUp(withExecBatch) {
+	standIn.reset({ latencyMs: latencyMs });
+	flowActions.forEach((action) => standIn.on(action, () => "KMC_SUCCESS"));
+	if (withExecBatch) {
+		standIn.on("kutExecBatch", (args) => args[0].map(() => ({ status: "OK", message: "KMC_SUCCESS" })));
+	}
+	return standIn.load("ActionUtils");
+}
+
+// Issues the flow the way DocumentsArray and PagesArray callers do: every call of a page is made before any answer arrives
+function runFlow(ActionUtils, mode) {
+	return new Promise((resolve) => {
+		let outstanding = pages * flowActions.length;
+		let done = () => {
+			if (--outstanding === 0) resolve();
+		};
+		if (mode === "explicit") ActionUtils.beginBatch();
+		if (mode === "auto") ActionUtils.setAutoBatching(true);
+		for (let page = 0; page < pages; page++) {
+			flowActions.forEach((action) => {
+				ActionUtils.exec(done, done, ActionUtils.serviceName, action, [{ pageID: "page" + page }]);
+			});
+		}
+		if (mode === "explicit") ActionUtils.commitBatch();
+	});
+}
+
+async function measure(label, withExecBatch, mode) {
+	let ActionUtils = setUp(withExecBatch);
+	await new Promise((resolve) => ActionUtils.isActionSupported(ActionUtils.kutExecBatch, resolve));
+	let before = standIn.calls().length;
+	let start = process.hrtime.bigint();
+	await runFlow(ActionUtils, mode);
+	let elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+	return {
+		mode: label,
+		calls: pages * flowActions.length,
+		roundTrips: standIn.calls().length - before,
+		elapsedMs: elapsedMs,
+	};
+}
+
+async function main() {
+	let rows = [
+		await measure("per call (native without kutExecBatch)", false, "explicit"),
+		await measure("per call", true, "none"),
+		await measure("explicit batch", true, "explicit"),
+		await measure("auto batch", true, "auto"),
+	];
+	console.log("pages: " + pages + ", latency per round-trip: " + latencyMs + " ms");
+	rows.forEach((row) => {
+		console.log(
+			row.mode.padEnd(42) +
+				("calls " + row.calls).padEnd(12) +
+				("round-trips " + row.roundTrips).padEnd(18) +
+				row.elapsedMs.toFixed(1) +
+				" ms"
+		);
+	});
+}
+
+main();
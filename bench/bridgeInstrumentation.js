@@ -0,0 +1,67 @@
+#!/usr/bin/env node
+"use strict";
+
+// JavaScript cost of bridge instrumentation per ActionUtils.exec call, with instrumentation disabled and enabled. The native
+// stand-in answers synchronously, so the time measured is the JavaScript side of the call alone: exec, the callback wrappers,
+// the histogram update and the span ring buffer. The two modes alternate over several runs after a warm-up, and the median run
+// of each is reported. Most of the time of a call is the JSON copy of the stand-in, which a WebView bridge also pays.
+//
+// usage: node bench/bridgeInstrumentation.js [calls] [runs]
+
+let standIn = require("../test/support/nativeStandIn");
+
+let calls = parseInt(process.argv[2], 10) || 20000;
+let runs = parseInt(process.argv[3], 10) || 25;
+let actions = ["kloCreatePageObject", "kedSetImageProperties", "kloAddImageToPage", "kloUpdateFields"];
+
+function median(values) {
+	let sorted = values.slice().sort((a, b) => a - b);
+	return sorted[Math.floor(sorted.length / 2)];
+}
+
+function setInstrumentation(ActionUtils, enabled) {
+	return new Promise((resolve, reject) => ActionUtils.setInstrumentation(resolve, reject, { enabled: enabled }));
+}
+
+// Nanoseconds per call of one run. The calls recorded by the stand-in are dropped first, so every run starts alike.
+function runCalls(ActionUtils, count) {
+	let answered = 0;
+	let done = () => answered++;
+	standIn.calls().length = 0;
+	if (global.gc) global.gc();
+	let start = process.hrtime.bigint();
+	for (let i = 0; i < count; i++) {
+		ActionUtils.exec(done, done, ActionUtils.serviceName, actions[i % actions.length], [{ pageID: "page" + i }]);
+	}
+	return Number(process.hrtime.bigint() - start) / count;
+}
+
+async function main() {
+	standIn.reset({ sync: true });
+	actions.forEach((action) => standIn.on(action, () => "KMC_SUCCESS"));
+	let ActionUtils = standIn.load("ActionUtils");
+	await new Promise((resolve) => ActionUtils.isActionSupported(actions[0], resolve));
+	runCalls(ActionUtils, calls);
+
+	// The two modes alternate, so drifts of the machine affect both alike
+	let times = { disabled: [], enabled: [] };
+	for (let run = 0; run < runs; run++) {
+		await setInstrumentation(ActionUtils, false);
+		times.disabled.push(runCalls(ActionUtils, calls));
+		await setInstrumentation(ActionUtils, true);
+		times.enabled.push(runCalls(ActionUtils, calls));
+	}
+	let metrics = await new Promise((resolve, reject) => ActionUtils.getBridgeMetrics(resolve, reject));
+	let recorded = Object.keys(metrics.js).reduce((total, action) => total + metrics.js[action].count, 0);
+
+	let disabled = median(times.disabled);
+	let enabled = median(times.enabled);
+	console.log("calls per run: " + calls + ", runs: " + runs + ", median per call:");
+	console.log("instrumentation disabled".padEnd(28) + disabled.toFixed(0) + " ns");
+	console.log(
+		"instrumentation enabled".padEnd(28) + (enabled.toFixed(0) + " ns").padEnd(12) + "calls recorded " + recorded
+	);
+	console.log("overhead".padEnd(28) + (enabled - disabled).toFixed(0) + " ns per call");
+}
+
+main();
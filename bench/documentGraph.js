@@ -0,0 +1,194 @@
+#!/usr/bin/env node
+"use strict";
+
+// Cost of refreshing a document list screen after one page was retaken and one field edited, read through the per-object
+// getters (getDocumentIds, getPropertiesOfDocument, getPropertiesOfPage, getImageProperties), through getDocumentGraph and
+// through getCachedDocumentGraph, which only fetches the changes with getDocumentGraphDelta. Every round-trip to the native
+// stand-in costs a fixed latency, standing in for the serialization and thread hops of the bridge; the bytes are the JSON
+// results sent back to JavaScript.
+//
+// usage: node bench/documentGraph.js [documents] [pagesPerDocument] [latencyMs]
+
+let standIn = require("../test/support/nativeStandIn");
+
+let documentCount = parseInt(process.argv[2], 10) || 5;
+let pagesPerDocument = parseInt(process.argv[3], 10) || 10;
+let latencyMs = process.argv[4] === undefined ? 1 : parseFloat(process.argv[4]);
+let refreshes = 10;
+let fieldsPerDocument = 20;
+
+// Native document graph, with the version at which each document and page last changed
+function createGraph() {
+	let graph = { version: 1, documents: {}, pages: {}, images: {}, documentIDs: [] };
+	for (let d = 0; d < documentCount; d++) {
+		let documentID = "document" + d;
+		let pageIDs = [];
+		for (let p = 0; p < pagesPerDocument; p++) {
+			let pageID = documentID + "-page" + p;
+			let imageID = pageID + "-image";
+			graph.images[imageID] = {
+				ID: imageID,
+				width: 2550,
+				height: 3300,
+				mimeType: "MIMETYPE_JPEG",
+				dpi: 300,
+				filePath: "/data/captures/" + imageID + ".jpg",
+				metaData: "",
+			};
+			graph.pages[pageID] = { pageID: pageID, documentID: documentID, side: "FRONT", imageIDs: [imageID], version: 1 };
+			pageIDs.push(pageID);
+		}
+		let fields = [];
+		for (let f = 0; f < fieldsPerDocument; f++) {
+			fields.push({ name: "Field" + f, value: "value " + f, confidence: 0.9, valid: true });
+		}
+		graph.documents[documentID] = {
+			documentID: documentID,
+			transactionID: "transaction" + d,
+			documentType: { typeName: "Invoice" },
+			fields: fields,
+			pageIDs: pageIDs,
+			version: 1,
+		};
+		graph.documentIDs.push(documentID);
+	}
+	return graph;
+}
+
+// Retakes the image of one page and edits one field of another document
+function edit(graph, refresh) {
+	graph.version++;
+	let documentIDs = graph.documentIDs;
+	let page = graph.pages[graph.documents[documentIDs[refresh % documentIDs.length]].pageIDs[0]];
+	let imageID = page.pageID + "-retake" + refresh;
+	graph.images[imageID] = Object.assign({}, graph.images[page.imageIDs[0]], { ID: imageID });
+	page.imageIDs = [imageID];
+	page.version = graph.version;
+	let document = graph.documents[documentIDs[(refresh + 1) % documentIDs.length]];
+	document.fields[0] = Object.assign({}, document.fields[0], { value: "edited " + refresh });
+	document.version = graph.version;
+}
+
+function pageResult(graph, page) {
+	return {
+		pageID: page.pageID,
+		documentID: page.documentID,
+		side: page.side,
+		images: page.imageIDs.map((imageID) => graph.images[imageID]),
+	};
+}
+
+function documentResult(document) {
+	return {
+		documentID: document.documentID,
+		transactionID: document.transactionID,
+		documentType: document.documentType,
+		fields: document.fields,
+		pageIDs: document.pageIDs,
+	};
+}
+
+function snapshot(graph, since) {
+	let documents = graph.documentIDs.map((documentID) => graph.documents[documentID]);
+	let pageIDs = documents.reduce((all, document) => all.concat(document.pageIDs), []);
+	let pages = pageIDs.map((pageID) => graph.pages[pageID]);
+	return {
+		version: graph.version,
+		documentIDs: graph.documentIDs,
+		documents: documents.filter((document) => document.version > since).map(documentResult),
+		pages: pages.filter((page) => page.version > since).map((page) => pageResult(graph, page)),
+		removedDocumentIDs: [],
+		removedPageIDs: [],
+	};
+}
+
+function setUp(graph, traffic) {
+	standIn.reset({ latencyMs: latencyMs });
+	let answer = (action, handler) =>
+		standIn.on(action, (args) => {
+			let result = handler(args);
+			traffic.bytes += JSON.stringify(result).length;
+			return result;
+		});
+	answer("kloGetDocumentIds", () => graph.documentIDs);
+	answer("kloGetDocumentProperties", (args) => documentResult(graph.documents[args[0].documentID]));
+	answer("kloGetPageProperties", (args) => {
+		let page = graph.pages[args[0].pageID];
+		return { pageID: page.pageID, documentID: page.documentID, side: page.side, imageIDs: page.imageIDs };
+	});
+	answer("kedGetImageProperties", (args) => graph.images[args[0].imageID]);
+	answer("kloGetDocumentGraph", () => snapshot(graph, 0));
+	answer("kloGetDocumentGraphDelta", (args) => snapshot(graph, args[0].sinceVersion));
+	return standIn.load("DocumentsArray");
+}
+
+function call(object, method) {
+	let args = Array.prototype.slice.call(arguments, 2);
+	return new Promise((resolve, reject) => object[method].apply(object, [resolve, reject].concat(args)));
+}
+
+// Reads the graph the way list screens do without the graph methods: every level is read once the level above has answered
+async function perObjectRefresh(DocumentsArray) {
+	let documentsArray = new DocumentsArray();
+	let PagesArray = require("../www/PagesArray");
+	let ImageArray = require("../www/ImageArray");
+	let pagesArray = new PagesArray();
+	let imageArray = new ImageArray();
+	let documentIDs = await call(documentsArray, "getDocumentIds");
+	let documents = await Promise.all(
+		documentIDs.map((documentID) => call(documentsArray, "getPropertiesOfDocument", { documentID: documentID }))
+	);
+	let pageIDs = documents.reduce((all, document) => all.concat(document.pageIDs), []);
+	let pages = await Promise.all(pageIDs.map((pageID) => call(pagesArray, "getPropertiesOfPage", { pageID: pageID })));
+	let imageIDs = pages.reduce((all, page) => all.concat(page.imageIDs), []);
+	await Promise.all(imageIDs.map((imageID) => call(imageArray, "getImageProperties", { imageID: imageID })));
+}
+
+async function measure(label, refresh) {
+	let graph = createGraph();
+	let traffic = { bytes: 0 };
+	let DocumentsArray = setUp(graph, traffic);
+	let ActionUtils = require("../www/ActionUtils");
+	await new Promise((resolve) => ActionUtils.isActionSupported(ActionUtils.kloGetDocumentGraph, resolve));
+	await refresh(DocumentsArray);
+	let before = standIn.calls().length;
+	traffic.bytes = 0;
+	let start = process.hrtime.bigint();
+	for (let i = 0; i < refreshes; i++) {
+		edit(graph, i);
+		await refresh(DocumentsArray);
+	}
+	let elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+	return {
+		mode: label,
+		roundTrips: (standIn.calls().length - before) / refreshes,
+		kilobytes: traffic.bytes / refreshes / 1024,
+		elapsedMs: elapsedMs / refreshes,
+	};
+}
+
+async function main() {
+	let documentsArray = null;
+	let cached = (DocumentsArray) => {
+		documentsArray = documentsArray || new DocumentsArray();
+		return call(documentsArray, "getCachedDocumentGraph");
+	};
+	let rows = [
+		await measure("per-object getters", perObjectRefresh),
+		await measure("getDocumentGraph", (DocumentsArray) => call(new DocumentsArray(), "getDocumentGraph")),
+		await measure("getCachedDocumentGraph (delta)", cached),
+	];
+	console.log("documents: " + documentCount + ", pages per document: " + pagesPerDocument);
+	console.log("latency per round-trip: " + latencyMs + " ms, per refresh:");
+	rows.forEach((row) => {
+		console.log(
+			row.mode.padEnd(34) +
+				("round-trips " + row.roundTrips.toFixed(0)).padEnd(18) +
+				("results " + row.kilobytes.toFixed(1) + " KB").padEnd(20) +
+				row.elapsedMs.toFixed(1) +
+				" ms"
+		);
+	});
+}
+
+main();
@@ -0,0 +1,86 @@
+#!/usr/bin/env node
+"use strict";
+
+// Pages per second through ImageProcessingQueue at 1, 2, 4 and 8 workers, and through the one-at-a-time fallback used on a
+// native layer without kenProcessImageBatch. The native stand-in processes each image in processingMs on a device with the given
+// number of cores; workers beyond the core count share them, so each of their images takes proportionally longer.
+//
+// usage: node bench/imageProcessingQueue.js [pages] [processingMs] [cores]
+
+let standIn = require("../test/support/nativeStandIn");
+
+let pages = parseInt(process.argv[2], 10) || 48;
+let processingMs = parseFloat(process.argv[3]) || 40;
+let cores = parseInt(process.argv[4], 10) || 4;
+
+// Time taken by one image while the given number of images are being processed
+function imageMs(running) {
+	return processingMs * Math.max(1, running / cores);
+}
+
+function workerPool() {
+	standIn.on("kenProcessImageBatch", (args, reply) => {
+		let jobs = args[0].jobs.slice();
+		let running = 0;
+		let startNext = () => {
+			if (jobs.length === 0 || running >= args[0].concurrency) return;
+			let job = jobs.shift();
+			running++;
+			setTimeout(() => {
+				running--;
+				reply.success({ eventType: "eventRaised", jobID: job.jobID, image: { ID: "processed_" + job.imageID } });
+				startNext();
+			}, imageMs(running));
+			startNext();
+		};
+		startNext();
+	});
+}
+
+function serialImageProcessor() {
+	let imageOut = null;
+	standIn.on("kenImageProcessorAddImageOutEventListener", (args, reply) => {
+		imageOut = reply;
+		return { eventType: "eventRegistered" };
+	});
+	standIn.on("kenImageProcessorRemoveImageOutEventListener", () => "KMC_SUCCESS");
+	standIn.on("kenProcessImage", (args) => {
+		setTimeout(() => imageOut.success({ eventType: "eventRaised", ID: "processed_" + args[0] }), imageMs(1));
+		return "KMC_SUCCESS";
+	});
+}
+
+async function measure(label, concurrency) {
+	standIn.reset();
+	if (concurrency) {
+		workerPool();
+	} else {
+		serialImageProcessor();
+	}
+	let ImageProcessingQueue = standIn.load("ImageProcessingQueue");
+	let queue = new ImageProcessingQueue({ concurrency: concurrency || 1 });
+	let start = process.hrtime.bigint();
+	await new Promise((resolve, reject) => {
+		let outstanding = pages;
+		for (let page = 0; page < pages; page++) {
+			queue.addJob(() => --outstanding === 0 && resolve(), reject, { imageID: "page" + page });
+		}
+	});
+	let elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+	return { mode: label, pagesPerSecond: (pages * 1000) / elapsedMs, elapsedMs: elapsedMs };
+}
+
+async function main() {
+	let rows = [await measure("one at a time (native without kenProcessImageBatch)", 0)];
+	for (let workers of [1, 2, 4, 8]) {
+		rows.push(await measure(workers + (workers === 1 ? " worker" : " workers"), workers));
+	}
+	console.log("pages: " + pages + ", processing per image: " + processingMs + " ms, cores: " + cores);
+	rows.forEach((row) => {
+		console.log(
+			row.mode.padEnd(54) + (row.pagesPerSecond.toFixed(1) + " pages/s").padEnd(18) + row.elapsedMs.toFixed(0) + " ms"
+		);
+	});
+}
+
+main();
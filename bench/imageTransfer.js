@@ -0,0 +1,122 @@
+#!/usr/bin/env node
+"use strict";
+
+// Peak heap and throughput of moving a 12 MP JPEG into the ImageArray through getImageFromBase64, getImageFromArrayBuffer and
+// its chunked variant. The native stand-in serializes every message as cordova/exec does, base64-encoding ArrayBuffer arguments,
+// so the bytes on the bridge are measured rather than assumed.
+//
+// usage: node --expose-gc bench/imageTransfer.js [imageMegabytes] [rounds]
+
+let standIn = require("../test/support/nativeStandIn");
+
+let imageBytes = Math.round((parseFloat(process.argv[2]) || 4.5) * 1024 * 1024);
+let rounds = parseInt(process.argv[3], 10) || 8;
+let gc = global.gc || (() => {});
+
+// A 12 MP JPEG is around 4.5 MB of high-entropy bytes, which is what base64 and JSON costs depend on
+function syntheticJpeg() {
+	let bytes = new Uint8Array(imageBytes);
+	let seed = 12345;
+	for (let i = 0; i < bytes.length; i++) {
+		seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+		bytes[i] = seed >> 16;
+	}
+	bytes[0] = 0xff;
+	bytes[1] = 0xd8;
+	return bytes.buffer;
+}
+
+// Live memory at the moments native holds a message, sampled after a full collection in a separate, untimed round
+let peak = 0;
+let tracking = false;
+function sample() {
+	if (!tracking) return;
+	gc();
+	let usage = process.memoryUsage();
+	peak = Math.max(peak, usage.heapUsed + usage.arrayBuffers);
+}
+
+function setUp(binaryActions) {
+	standIn.reset();
+	let stored = 0;
+	let store = () => {
+		sample();
+		return "image" + ++stored;
+	};
+	standIn.on("kedGetImageFromBase64", store);
+	if (binaryActions) {
+		standIn.on("kedGetImageFromArrayBuffer", store);
+		standIn.on("kedAppendImageChunk", (args) => {
+			if (args[0].last) return store();
+			sample();
+			return "KMC_SUCCESS";
+		});
+	}
+	let ImageArray = standIn.load("ImageArray");
+	return new ImageArray();
+}
+
+function convert(imageArray, mode, jpeg) {
+	return new Promise((resolve, reject) => {
+		if (mode === "base64") {
+			// What callers had to do before: encode the bytes themselves
+			imageArray.getImageFromBase64(resolve, reject, Buffer.from(jpeg).toString("base64"));
+		} else {
+			imageArray.getImageFromArrayBuffer(resolve, reject, jpeg);
+		}
+	});
+}
+
+async function measure(label, mode, binaryActions, transferOptions) {
+	let imageArray = setUp(binaryActions);
+	if (transferOptions) imageArray.setBinaryTransferOptions(transferOptions);
+	let jpeg = syntheticJpeg();
+	await convert(imageArray, mode, jpeg);
+	let before = standIn.calls().length;
+	let start = process.hrtime.bigint();
+	for (let round = 0; round < rounds; round++) {
+		await convert(imageArray, mode, jpeg);
+	}
+	let elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+	let calls = standIn.calls().slice(before);
+	gc();
+	let usage = process.memoryUsage();
+	let baseline = usage.heapUsed + usage.arrayBuffers;
+	peak = baseline;
+	tracking = true;
+	await convert(imageArray, mode, jpeg);
+	tracking = false;
+	let bridgeBytes = calls.reduce((total, call) => total + call.messageBytes, 0) / rounds;
+	let largestMessage = Math.max.apply(null, calls.map((call) => call.messageBytes));
+	return {
+		mode: label,
+		imagesPerSecond: (rounds * 1000) / elapsedMs,
+		bridgeMB: bridgeBytes / 1048576,
+		largestMessageMB: largestMessage / 1048576,
+		peakHeapMB: (peak - baseline) / 1048576,
+	};
+}
+
+async function main() {
+	let rows = [
+		await measure("getImageFromBase64", "base64", false),
+		await measure("getImageFromArrayBuffer, lib/ native", "buffer", false),
+		await measure("getImageFromArrayBuffer, single call", "buffer", true, { chunkThreshold: imageBytes }),
+		await measure("getImageFromArrayBuffer, 1 MB chunks", "buffer", true, { chunkThreshold: 1048576 }),
+	];
+	let megabytes = (imageBytes / 1048576).toFixed(1);
+	console.log("image: " + megabytes + " MB, rounds: " + rounds + (global.gc ? "" : " (peak heap needs --expose-gc)"));
+	rows.forEach((row) => {
+		console.log(
+			row.mode.padEnd(40) +
+				(row.imagesPerSecond.toFixed(1) + " images/s").padEnd(16) +
+				("bridge " + row.bridgeMB.toFixed(2) + " MB").padEnd(18) +
+				("largest message " + row.largestMessageMB.toFixed(2) + " MB").padEnd(28) +
+				"peak heap +" +
+				row.peakHeapMB.toFixed(1) +
+				" MB"
+		);
+	});
+}
+
+main();
@@ -0,0 +1,132 @@
+#!/usr/bin/env node
+"use strict";
+
+// Per page cost of writing the full resolution JPEG, a review thumbnail and a downscaled TIFF for extraction through
+// imageWriteToFile with an outputs list, with and without kedImageWriteToFiles. Without it every output is a kedImageWriteToFile
+// call which decodes the image again and encodes it at full size; with it the image is decoded once, each output is resampled
+// from that bitmap and the outputs are encoded in parallel. The native stand-in answers after the modelled native time of each
+// call and tracks the modelled native CPU time and peak bitmap memory; the costs per pixel below are estimates for a mid-range
+// device, not measurements.
+//
+// usage: node bench/imageWriteOutputs.js [pages]
+
+let standIn = require("../test/support/nativeStandIn");
+
+let pages = parseInt(process.argv[2], 10) || 6;
+
+// Sample captures: 12, 8 and 5 megapixel cameras
+let corpus = [
+	[4000, 3000],
+	[3264, 2448],
+	[2592, 1944],
+];
+let outputs = [
+	{ filePath: "page.jpg", jpegQuality: 90 },
+	{ filePath: "page_thumbnail.jpg", maxDimension: 256, jpegQuality: 70 },
+	{ filePath: "page_extraction.tif", format: "TIFF_G4", maxDimension: 2000, dpi: 200 },
+];
+
+// Modelled native cost in nanoseconds per pixel, and bytes per pixel of a decoded bitmap
+let decodeNs = 9;
+let resampleNs = 1.5;
+let encodeNs = { JPEG: 7, PNG: 18, TIFF_G4: 3 };
+let bitmapBytes = 4;
+
+let native;
+
+function outputSize(size, output) {
+	let scale = output.maxDimension ? Math.min(1, output.maxDimension / Math.max(size[0], size[1])) : 1;
+	return Math.round(size[0] * scale) * Math.round(size[1] * scale);
+}
+
+// Accounts native CPU time and live bitmap memory, and returns the time the call takes on the device
+function work(cpuMs, wallMs, liveBytes) {
+	native.cpuMs += cpuMs;
+	native.peakBytes = Math.max(native.peakBytes, liveBytes);
+	return wallMs;
+}
+
+function setUp(withWriteToFiles) {
+	let size = null;
+	let format = "JPEG";
+	native = { cpuMs: 0, peakBytes: 0 };
+	let answer = (reply, ms, value) => setTimeout(() => reply.success(value), ms);
+	standIn.reset();
+	standIn.on("kedGetImageProperties", () => ({ mimeType: "MIMETYPE_JPEG", dpi: 300, jpegQuality: 95 }));
+	standIn.on("kedSetImageProperties", (args) => {
+		format = { MIMETYPE_TIFF: "TIFF_G4", MIMETYPE_PNG: "PNG" }[args[0].mimeType] || "JPEG";
+		return "KMC_SUCCESS";
+	});
+	standIn.on("kedImageWriteToFile", (args, reply) => {
+		let pixels = size[0] * size[1];
+		let cpuMs = (pixels * (decodeNs + encodeNs[format])) / 1e6;
+		answer(reply, work(cpuMs, cpuMs, pixels * bitmapBytes), "KMC_SUCCESS");
+	});
+	if (withWriteToFiles) {
+		standIn.on("kedImageWriteToFiles", (args, reply) => {
+			let pixels = size[0] * size[1];
+			let decodeMs = (pixels * decodeNs) / 1e6;
+			let resampleMs = 0;
+			let encodeMs = [];
+			let liveBytes = pixels * bitmapBytes;
+			args[0].outputs.forEach((output) => {
+				let outputPixels = outputSize(size, output);
+				if (outputPixels < pixels) resampleMs += (pixels * resampleNs) / 1e6;
+				encodeMs.push((outputPixels * encodeNs[output.format || "JPEG"]) / 1e6);
+				liveBytes += outputPixels < pixels ? outputPixels * bitmapBytes : 0;
+			});
+			let cpuMs = decodeMs + resampleMs + encodeMs.reduce((a, b) => a + b, 0);
+			let wallMs = decodeMs + resampleMs + Math.max.apply(null, encodeMs);
+			let results = args[0].outputs.map((output) => ({ filePath: output.filePath }));
+			answer(reply, work(cpuMs, wallMs, liveBytes), results);
+		});
+	}
+	let ImageArray = standIn.load("ImageArray");
+	return {
+		imageArray: new ImageArray(),
+		setPage: (page) => (size = page),
+	};
+}
+
+async function measure(label, withWriteToFiles) {
+	let bench = setUp(withWriteToFiles);
+	let ActionUtils = require("../www/ActionUtils");
+	await new Promise((resolve) => ActionUtils.isActionSupported(ActionUtils.imageWriteToFiles, resolve));
+	let before = standIn.calls().length;
+	let start = process.hrtime.bigint();
+	for (let page = 0; page < pages; page++) {
+		bench.setPage(corpus[page % corpus.length]);
+		await new Promise((resolve, reject) =>
+			bench.imageArray.imageWriteToFile(resolve, reject, { imageID: "page" + page, outputs: outputs })
+		);
+	}
+	let elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+	return {
+		mode: label,
+		bridgeCalls: (standIn.calls().length - before) / pages,
+		wallMs: elapsedMs / pages,
+		nativeCpuMs: native.cpuMs / pages,
+		peakMB: native.peakBytes / 1048576,
+	};
+}
+
+async function main() {
+	let rows = [
+		await measure("one kedImageWriteToFile per output", false),
+		await measure("kedImageWriteToFiles", true),
+	];
+	console.log("pages: " + pages + ", outputs per page: " + outputs.length + ", per page:");
+	rows.forEach((row) => {
+		console.log(
+			row.mode.padEnd(38) +
+				("bridge calls " + row.bridgeCalls.toFixed(0)).padEnd(18) +
+				("wall " + row.wallMs.toFixed(0) + " ms").padEnd(14) +
+				("native CPU " + row.nativeCpuMs.toFixed(0) + " ms").padEnd(20) +
+				"peak bitmaps " +
+				row.peakMB.toFixed(0) +
+				" MB"
+		);
+	});
+}
+
+main();
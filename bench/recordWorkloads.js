@@ -0,0 +1,215 @@
+#!/usr/bin/env node
+"use strict";
+
+// Records the workload traces in bench/traces with ActionUtils.startRecording, for bench/regression.js to replay. Each workload
+// makes the bridge calls of an application flow through ActionUtils.exec, against a native stand-in which answers after the
+// latencies below and raises the listener events of the capture, processing, extraction and submission steps. The latencies
+// and sizes are modelled on a mid-range device; record the traces of a real session with startRecording to replace them.
+//
+// usage: node bench/recordWorkloads.js [outputDirectory]
+
+let fs = require("fs");
+let path = require("path");
+let standIn = require("../test/support/nativeStandIn");
+
+let outputDirectory = process.argv[2] || path.join(__dirname, "traces");
+
+// Native latency in milliseconds and result size in bytes of the plain actions
+let native = {
+	kuiAddCameraView: [30, 60],
+	kuiRemoveCameraView: [12, 12],
+	kuiDCBindCaptureControl: [15, 12],
+	kuiDCSetOptions: [8, 12],
+	kuiDCStopCapture: [6, 12],
+	kuiDCDestroy: [10, 12],
+	kuiPCBindCaptureControl: [15, 12],
+	kuiPCSetOptions: [8, 12],
+	kuiPCStopCapture: [6, 12],
+	kuiPCDestroy: [10, 12],
+	kenImageProcessorSetOptions: [5, 12],
+	kedGetImageProperties: [3, 600],
+	kedGetImageFromFilePath: [40, 320],
+	kloCreatePageObject: [3, 180],
+	kloAddImageToPage: [2, 12],
+	kloAddPageToDocument: [2, 12],
+	kloCreateDocumentWithDocumentType: [10, 900],
+	kloUpdateFields: [5, 12],
+	kenODESetProvider: [20, 12],
+	kenODEWarmUp: [150, 40],
+	kloCaptureServerCreate: [20, 12],
+	kloCaptureServerLogin: [120, 300],
+};
+
+let listeners = {};
+
+function sleep(ms) {
+	return new Promise((resolve) => setTimeout(resolve, ms));
+}
+
+function setUp() {
+	standIn.reset();
+	listeners = {};
+	Object.keys(native).forEach((action) => {
+		standIn.on(action, (args, reply) => {
+			setTimeout(() => reply.success("x".repeat(native[action][1] - 2)), native[action][0]);
+			return undefined;
+		});
+	});
+	return standIn.load("ActionUtils");
+}
+
+// A listener action: answers eventRegistered, then raises the events sent with raise()
+function listener(action) {
+	standIn.on(action, (args, reply) => {
+		listeners[action] = reply;
+		return { eventType: "eventRegistered" };
+	});
+}
+
+function raise(action, bytes) {
+	listeners[action].success({ eventType: "eventRaised", data: "x".repeat(bytes) });
+}
+
+// An action acknowledged at once whose outcome arrives later through a listener
+function asynchronous(action, ackMs, outcome) {
+	standIn.on(action, (args, reply) => {
+		setTimeout(() => {
+			reply.success("KMC_SUCCESS");
+			outcome(reply);
+		}, ackMs);
+		return undefined;
+	});
+}
+
+function call(ActionUtils, action, argBytes) {
+	return new Promise((resolve, reject) =>
+		ActionUtils.exec(resolve, reject, ActionUtils.serviceName, action, [{ data: "x".repeat(argBytes || 0) }])
+	);
+}
+
+// Raises levelness events every 50 ms until the capture, the focus event once, and the captured event after captureMs
+function captureFrames(levelness, focus, captured, captureMs, capturedBytes) {
+	let frames = setInterval(() => raise(levelness, 60), 50);
+	setTimeout(() => raise(focus, 40), captureMs / 2);
+	setTimeout(() => {
+		clearInterval(frames);
+		raise(captured, capturedBytes);
+	}, captureMs);
+}
+
+async function documentCapture(ActionUtils) {
+	["kuiAddLevelnessListener", "kuiAddFocusListener", "kuiDCAddImageCapturedListener"].forEach(listener);
+	listener("kenImageProcessorAddImageOutEventListener");
+	asynchronous("kuiDCTakePictureContinually", 5, () =>
+		captureFrames("kuiAddLevelnessListener", "kuiAddFocusListener", "kuiDCAddImageCapturedListener", 650, 400)
+	);
+	asynchronous("kenProcessImage", 5, () =>
+		setTimeout(() => raise("kenImageProcessorAddImageOutEventListener", 300), 250)
+	);
+	await call(ActionUtils, "kuiAddCameraView", 80);
+	await call(ActionUtils, "kuiDCBindCaptureControl", 20);
+	await call(ActionUtils, "kuiDCSetOptions", 1400);
+	await call(ActionUtils, "kuiAddLevelnessListener");
+	await call(ActionUtils, "kuiAddFocusListener");
+	await call(ActionUtils, "kuiDCAddImageCapturedListener");
+	await call(ActionUtils, "kenImageProcessorAddImageOutEventListener");
+	await call(ActionUtils, "kenImageProcessorSetOptions", 700);
+	for (let page = 0; page < 3; page++) {
+		await call(ActionUtils, "kuiDCTakePictureContinually", 60);
+		await sleep(660);
+		await call(ActionUtils, "kuiDCStopCapture");
+		await call(ActionUtils, "kenProcessImage", 40);
+		await sleep(260);
+		await call(ActionUtils, "kedGetImageProperties", 40);
+		await call(ActionUtils, "kloCreatePageObject", 200);
+		await call(ActionUtils, "kloAddImageToPage", 60);
+	}
+	await call(ActionUtils, "kuiDCDestroy");
+	await call(ActionUtils, "kuiRemoveCameraView");
+}
+
+async function passportOde(ActionUtils) {
+	["kuiAddLevelnessListener", "kuiAddFocusListener", "kuiPCAddImageCapturedListener"].forEach(listener);
+	["kenODEAddOnDeviceExtractionListener", "kenODEAddFrontProcessedImageListener"].forEach(listener);
+	asynchronous("kuiPCTakePictureContinually", 5, () =>
+		captureFrames("kuiAddLevelnessListener", "kuiAddFocusListener", "kuiPCAddImageCapturedListener", 900, 500)
+	);
+	asynchronous("kenODEExtractData", 5, () => {
+		setTimeout(() => raise("kenODEAddFrontProcessedImageListener", 300), 300);
+		setTimeout(() => raise("kenODEAddOnDeviceExtractionListener", 8000), 700);
+	});
+	await call(ActionUtils, "kuiAddCameraView", 80);
+	await call(ActionUtils, "kuiPCBindCaptureControl", 20);
+	await call(ActionUtils, "kuiPCSetOptions", 1200);
+	await call(ActionUtils, "kuiAddLevelnessListener");
+	await call(ActionUtils, "kuiAddFocusListener");
+	await call(ActionUtils, "kuiPCAddImageCapturedListener");
+	await call(ActionUtils, "kenODESetProvider", 400);
+	await call(ActionUtils, "kenODEWarmUp", 60);
+	await call(ActionUtils, "kenODEAddOnDeviceExtractionListener");
+	await call(ActionUtils, "kenODEAddFrontProcessedImageListener");
+	await call(ActionUtils, "kuiPCTakePictureContinually", 60);
+	await sleep(910);
+	await call(ActionUtils, "kuiPCStopCapture");
+	await call(ActionUtils, "kenODEExtractData", 300);
+	await sleep(710);
+	await call(ActionUtils, "kuiPCDestroy");
+	await call(ActionUtils, "kuiRemoveCameraView");
+}
+
+async function batchSubmit(ActionUtils) {
+	listener("kloCaptureServeraddProgressListener");
+	standIn.on("kloCaptureServerSubmitDocument", (args, reply) => {
+		let percent = 0;
+		let progress = setInterval(() => {
+			percent += 10;
+			raise("kloCaptureServeraddProgressListener", 80);
+			if (percent === 100) {
+				clearInterval(progress);
+				reply.success("KMC_SUCCESS");
+			}
+		}, 100);
+		return undefined;
+	});
+	await call(ActionUtils, "kloCaptureServerCreate", 200);
+	await call(ActionUtils, "kloCaptureServerLogin", 120);
+	await call(ActionUtils, "kloCreateDocumentWithDocumentType", 40);
+	for (let page = 0; page < 10; page++) {
+		await call(ActionUtils, "kedGetImageFromFilePath", 90);
+		await call(ActionUtils, "kloCreatePageObject", 200);
+		await call(ActionUtils, "kloAddImageToPage", 60);
+		await call(ActionUtils, "kloAddPageToDocument", 60);
+	}
+	await call(ActionUtils, "kloUpdateFields", 1600);
+	await call(ActionUtils, "kloCaptureServeraddProgressListener");
+	await call(ActionUtils, "kloCaptureServerSubmitDocument", 120);
+}
+
+// One event per line keeps the checked-in traces readable and their diffs small
+function format(trace) {
+	let round = (value) => +value.toFixed(1);
+	let lines = trace.events.map((event) => "\t\t" + JSON.stringify(Object.assign({}, event, { t: round(event.t) })));
+	let header = [
+		'\t"version": ' + trace.version,
+		'\t"startedAt": ' + JSON.stringify(trace.startedAt),
+		'\t"durationMs": ' + round(trace.durationMs),
+		'\t"droppedEvents": ' + trace.droppedEvents,
+	];
+	return "{\n" + header.join(",\n") + ',\n\t"events": [\n' + lines.join(",\n") + "\n\t]\n}\n";
+}
+
+async function main() {
+	let workloads = { documentCapture: documentCapture, passportOde: passportOde, batchSubmit: batchSubmit };
+	fs.mkdirSync(outputDirectory, { recursive: true });
+	for (let name of Object.keys(workloads)) {
+		let ActionUtils = setUp();
+		ActionUtils.startRecording();
+		await workloads[name](ActionUtils);
+		await standIn.settle();
+		let trace = ActionUtils.stopRecording();
+		fs.writeFileSync(path.join(outputDirectory, name + ".json"), format(trace));
+		console.log(name.padEnd(18) + (trace.events.length + " events").padEnd(14) + trace.durationMs.toFixed(0) + " ms");
+	}
+}
+
+main();
@@ -0,0 +1,107 @@
+#!/usr/bin/env node
+"use strict";
+
+// Replays the workload traces in bench/traces and compares the JavaScript cost of each with bench/traces/baseline.json. A
+// metric regresses when its median over the runs exceeds the baseline by more than the threshold, plus a small absolute slack
+// for timer and GC noise; a replay which does not deliver every recorded callback, or delivers an error, always fails. The
+// baseline depends on the machine and Node version: record it with --update-baseline on the machine which runs the check.
+//
+// usage: node bench/regression.js [--runs N] [--threshold PERCENT] [--update-baseline]
+
+let fs = require("fs");
+let path = require("path");
+let traceReplayer = require("../test/support/traceReplayer");
+
+let tracesDirectory = path.join(__dirname, "traces");
+let baselinePath = path.join(tracesDirectory, "baseline.json");
+
+// Metrics compared with the baseline, with their absolute slack
+let metrics = {
+	cpuMs: 5,
+	latencyP95Ms: 2,
+	peakHeapMB: 1,
+};
+
+function option(name, fallback) {
+	let index = process.argv.indexOf(name);
+	return index < 0 ? fallback : parseFloat(process.argv[index + 1]);
+}
+
+let runs = option("--runs", 5);
+let threshold = option("--threshold", 25) / 100;
+let updateBaseline = process.argv.indexOf("--update-baseline") >= 0;
+
+function median(values) {
+	let sorted = values.slice().sort((a, b) => a - b);
+	return sorted[Math.floor(sorted.length / 2)];
+}
+
+async function measure(trace) {
+	let results = [];
+	for (let run = 0; run < runs; run++) {
+		results.push(await traceReplayer.replay(trace));
+	}
+	let incomplete = results.find((result) => result.callbacks !== result.expectedCallbacks || result.errors > 0);
+	return {
+		callbacks: incomplete ? incomplete.callbacks : results[0].callbacks,
+		expectedCallbacks: results[0].expectedCallbacks,
+		errors: incomplete ? incomplete.errors : 0,
+		cpuMs: median(results.map((result) => result.cpuMs)),
+		latencyP95Ms: median(results.map((result) => result.latencyMs.p95)),
+		peakHeapMB: median(results.map((result) => result.peakHeapMB)),
+	};
+}
+
+function round(value) {
+	return +value.toFixed(2);
+}
+
+async function main() {
+	let names = fs
+		.readdirSync(tracesDirectory)
+		.filter((file) => file.endsWith(".json") && file !== "baseline.json")
+		.map((file) => file.slice(0, -".json".length))
+		.sort();
+	let baseline = fs.existsSync(baselinePath) ? JSON.parse(fs.readFileSync(baselinePath, "utf8")) : {};
+	let measured = {};
+	let failures = [];
+
+	for (let name of names) {
+		let trace = JSON.parse(fs.readFileSync(path.join(tracesDirectory, name + ".json"), "utf8"));
+		let result = await measure(trace);
+		measured[name] = {};
+		Object.keys(metrics).forEach((metric) => (measured[name][metric] = round(result[metric])));
+
+		if (result.callbacks !== result.expectedCallbacks || result.errors > 0) {
+			failures.push(
+				name + ": " + result.callbacks + " of " + result.expectedCallbacks + " callbacks, " + result.errors + " errors"
+			);
+		}
+		let line = name.padEnd(18);
+		Object.keys(metrics).forEach((metric) => {
+			let value = measured[name][metric];
+			let reference = baseline[name] && baseline[name][metric];
+			line += (metric + " " + value).padEnd(22);
+			if (updateBaseline || reference === undefined) return;
+			let limit = reference * (1 + threshold) + metrics[metric];
+			if (value > limit) {
+				failures.push(
+					name + ": " + metric + " " + value + " exceeds " + round(limit) + " (baseline " + reference + ")"
+				);
+			}
+		});
+		console.log(line.trimEnd());
+	}
+
+	if (updateBaseline) {
+		fs.writeFileSync(baselinePath, JSON.stringify(measured, null, "\t") + "\n");
+		console.log("baseline written to " + path.relative(process.cwd(), baselinePath));
+		return;
+	}
+	if (failures.length) {
+		failures.forEach((failure) => console.error("REGRESSION " + failure));
+		process.exitCode = 1;
+	}
+}
+
+main();
@@ -0,0 +1,147 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+let ok = (args) => ({ echo: args[0] });
+
+let execBatchHandler = (args) => args[0].map((operation) => ({ status: "OK", message: { echo: operation.args[0] } }));
+
+test("batched calls go out one by one on a native layer without kutExecBatch", async () => {
+	standIn.reset();
+	standIn.on("kloAddImageToPage", ok);
+	standIn.on("kloAddPageToDocument", ok);
+	let ActionUtils = standIn.load("ActionUtils");
+	let results = [];
+	ActionUtils.beginBatch();
+	ActionUtils.exec((r) => results.push(r.echo), null, ActionUtils.serviceName, "kloAddImageToPage", ["a"]);
+	ActionUtils.exec((r) => results.push(r.echo), null, ActionUtils.serviceName, "kloAddPageToDocument", ["b"]);
+	ActionUtils.commitBatch();
+	await standIn.settle();
+	assert.deepStrictEqual(results, ["a", "b"]);
+	assert.strictEqual(standIn.calls("kutExecBatch").length, 0);
+});
+
+test("a batch answered with Invalid action is sent again one call at a time", async () => {
+	standIn.reset();
+	standIn.on("kloAddImageToPage", ok);
+	standIn.on("kutExecBatch", () => undefined);
+	let ActionUtils = standIn.load("ActionUtils");
+	await new Promise((resolve) => ActionUtils.isActionSupported("kutExecBatch", resolve));
+	standIn.off("kutExecBatch");
+	let results = [];
+	ActionUtils.execBatch(
+		(all) => results.push(all.length),
+		null,
+		[
+			{ action: "kloAddImageToPage", args: ["a"], success: (r) => results.push(r.echo) },
+			{ action: "kloAddImageToPage", args: ["b"], success: (r) => results.push(r.echo) },
+		]
+	);
+	await standIn.settle();
+	assert.deepStrictEqual(results, ["a", "b", 2]);
+	assert.strictEqual(standIn.calls("kloAddImageToPage").length, 2);
+});
+
+test("an explicit batch is sent as one unit even when a non-batchable call is made inside it", async () => {
+	standIn.reset();
+	standIn.on("kutExecBatch", execBatchHandler);
+	standIn.on("kuiAddLevelnessListener", ok);
+	let ActionUtils = standIn.load("ActionUtils");
+	await new Promise((resolve) => ActionUtils.isActionSupported("kutExecBatch", resolve));
+	ActionUtils.setAutoBatching(true);
+	ActionUtils.exec(null, null, ActionUtils.serviceName, "kloAddImageToPage", ["auto"]);
+	ActionUtils.beginBatch();
+	ActionUtils.exec(null, null, ActionUtils.serviceName, "kloAddImageToPage", ["a"]);
+	ActionUtils.exec(null, null, ActionUtils.serviceName, "kuiAddLevelnessListener", ["listener"]);
+	ActionUtils.exec(null, null, ActionUtils.serviceName, "kloAddPageToDocument", ["b"]);
+	await Promise.resolve();
+	assert.strictEqual(standIn.calls("kutExecBatch").length, 0, "the microtask flush must not split the explicit batch");
+	ActionUtils.commitBatch();
+	await standIn.settle();
+	let batches = standIn.calls("kutExecBatch");
+	assert.strictEqual(batches.length, 1);
+	assert.deepStrictEqual(
+		batches[0].args[0].map((operation) => operation.args[0]),
+		["auto", "a", "b"]
+	);
+	let order = standIn.calls().map((call) => call.action);
+	assert.ok(order.indexOf("kuiAddLevelnessListener") > order.indexOf("kutExecBatch"));
+});
+
+test("execExtended reports Invalid action without reaching a native layer which lacks the action", async () => {
+	standIn.reset();
+	let ActionUtils = standIn.load("ActionUtils");
+	let error = await new Promise((resolve) =>
+		ActionUtils.execExtended(null, resolve, ActionUtils.serviceName, "kutSomethingNew", [])
+	);
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+	assert.strictEqual(standIn.calls("kutSomethingNew").length, 0);
+});
+
+test("execExtended gives up on the capability probe when iOS never answers it", async () => {
+	standIn.reset({ platform: "ios" });
+	standIn.off("kutGetNativeCapabilities");
+	let ActionUtils = standIn.load("ActionUtils");
+	let fellBack = await new Promise((resolve) =>
+		ActionUtils.execExtended(null, null, ActionUtils.serviceName, "kutSomethingNew", [], () => resolve(true))
+	);
+	assert.strictEqual(fellBack, true);
+});
+
+test("instrumentation stays off when native fails and works without native support", async () => {
+	standIn.reset();
+	standIn.on("kutSetBridgeInstrumentation", (args, reply) => reply.error({ ErrorMsg: "KMC_EXCEPTION" }));
+	standIn.on("kloAddImageToPage", ok);
+	let ActionUtils = standIn.load("ActionUtils");
+	let error = await new Promise((resolve) => ActionUtils.setInstrumentation(null, resolve, { enabled: true }));
+	assert.strictEqual(error.ErrorMsg, "KMC_EXCEPTION");
+	await new Promise((resolve) => ActionUtils.exec(resolve, null, ActionUtils.serviceName, "kloAddImageToPage", ["a"]));
+	let metrics = await new Promise((resolve) => ActionUtils.getBridgeMetrics(resolve, null));
+	assert.deepStrictEqual(metrics.js, {}, "instrumentation must stay off after a failed switch");
+
+	standIn.off("kutSetBridgeInstrumentation");
+	ActionUtils = standIn.load("ActionUtils");
+	await new Promise((resolve, reject) => ActionUtils.setInstrumentation(resolve, reject, { enabled: true }));
+	await new Promise((resolve) => ActionUtils.exec(resolve, null, ActionUtils.serviceName, "kloAddImageToPage", ["a"]));
+	metrics = await new Promise((resolve) => ActionUtils.getBridgeMetrics(resolve, null));
+	assert.strictEqual(metrics.js.kloAddImageToPage.count, 1);
+	assert.strictEqual(metrics.native, undefined);
+	let trace = await new Promise((resolve) => ActionUtils.exportChromeTrace(resolve, null));
+	assert.deepStrictEqual(
+		trace.traceEvents.map((event) => event.name),
+		["kloAddImageToPage"]
+	);
+});
+
+for (let platform of ["android", "ios"]) {
+	test("calls made after a gated call reach native after it on " + platform, async () => {
+		standIn.reset({ platform: platform });
+		standIn.on("kutSomethingNew", ok);
+		standIn.on("kuiPlain", ok);
+		standIn.on("kuiFallback", ok);
+		if (platform === "ios") standIn.off("kutGetNativeCapabilities");
+		let ActionUtils = standIn.load("ActionUtils");
+		let send = (action) => ActionUtils.exec(null, null, ActionUtils.serviceName, action, [action]);
+		send("kuiPlain");
+		ActionUtils.execExtended(null, null, ActionUtils.serviceName, "kutSomethingNew", [], () => send("kuiFallback"));
+		send("kuiPlain");
+		ActionUtils.isActionSupported("kutSomethingNew", () => send("kuiFallback"));
+		send("kuiPlain");
+		await new Promise((resolve) => ActionUtils.isActionSupported("kutSomethingNew", resolve));
+		await standIn.settle();
+		let gated = platform === "ios" ? "kuiFallback" : "kutSomethingNew";
+		assert.deepStrictEqual(
+			standIn.calls().map((call) => call.action),
+			["kuiPlain", "kutGetNativeCapabilities", gated, "kuiPlain", "kuiFallback", "kuiPlain"]
+		);
+	});
+}
+
+test("the capability probe starts when the module loads", async () => {
+	standIn.reset();
+	standIn.load("ActionUtils");
+	await standIn.settle();
+	assert.strictEqual(standIn.calls("kutGetNativeCapabilities").length, 1);
+});
@@ -0,0 +1,77 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+function logEvents(appStats, count, outcomes) {
+	for (let i = 1; i <= count; i++) {
+		appStats.logSessionEvent(
+			() => outcomes.push(i + " logged"),
+			(error) => outcomes.push(i + " " + error.ErrorMsg),
+			{ type: "Retake", response: String(i) }
+		);
+	}
+}
+
+test("session events beyond the capacity are dropped while native has not acknowledged earlier batches", async () => {
+	standIn.reset({ latencyMs: 20 });
+	standIn.on("kutAppStatsLogSessionEvents", () => "KMC_SUCCESS");
+	let AppStatsObject = standIn.load("AppStatsObject");
+	let appStats = new AppStatsObject();
+	appStats.setEventBatching({ enabled: true, batchSize: 2, capacity: 4 });
+	let outcomes = [];
+	logEvents(appStats, 6, outcomes);
+	await new Promise((resolve) => setTimeout(resolve, 10));
+	assert.deepStrictEqual(outcomes, ["5 KMC_AS_SESSION_EVENT_DROPPED", "6 KMC_AS_SESSION_EVENT_DROPPED"]);
+	await standIn.settle();
+	assert.strictEqual(appStats.getDroppedEventCount(), 2);
+	assert.deepStrictEqual(outcomes.slice(2).sort(), ["1 logged", "2 logged", "3 logged", "4 logged"]);
+	logEvents(appStats, 2, outcomes);
+	await standIn.settle();
+	assert.strictEqual(appStats.getDroppedEventCount(), 2, "acknowledged events free the capacity");
+	assert.strictEqual(standIn.calls("kutAppStatsLogSessionEvents").length, 3);
+});
+
+test("batched session events go one call each to a native layer without kutAppStatsLogSessionEvents", async () => {
+	standIn.reset();
+	standIn.on("kutAppStatsLogSessionEvent", () => "KMC_SUCCESS");
+	let AppStatsObject = standIn.load("AppStatsObject");
+	let appStats = new AppStatsObject();
+	appStats.setEventBatching({ enabled: true, batchSize: 3 });
+	let outcomes = [];
+	logEvents(appStats, 3, outcomes);
+	await new Promise((resolve) => setTimeout(resolve, 10));
+	await standIn.settle();
+	assert.deepStrictEqual(outcomes, ["1 logged", "2 logged", "3 logged"]);
+	assert.deepStrictEqual(
+		standIn.calls("kutAppStatsLogSessionEvent").map((call) => call.args[0].response),
+		["1", "2", "3"]
+	);
+});
+
+for (let batchAction of ["kutAppStatsLogSessionEvents", null]) {
+	let sent = batchAction ? "in one call" : "one call each";
+	test("buffered session events reach native before the session ends, sent " + sent, async () => {
+		standIn.reset();
+		["kutAppStatsBeginSession", "kutAppStatsLogSessionEvent", "kutAppStatsEndSession"].forEach((action) =>
+			standIn.on(action, () => "KMC_SUCCESS")
+		);
+		if (batchAction) standIn.on(batchAction, () => "KMC_SUCCESS");
+		let AppStatsObject = standIn.load("AppStatsObject");
+		let appStats = new AppStatsObject();
+		appStats.setEventBatching({ enabled: true, batchSize: 8 });
+		appStats.beginSession(null, null, { category: "BillPay" });
+		logEvents(appStats, 2, []);
+		await new Promise((resolve) => appStats.endSession(resolve, null, { success: true }));
+		await standIn.settle();
+		let events = batchAction ? [batchAction] : ["kutAppStatsLogSessionEvent", "kutAppStatsLogSessionEvent"];
+		assert.deepStrictEqual(
+			standIn
+				.calls()
+				.map((call) => call.action)
+				.filter((action) => action !== "kutGetNativeCapabilities"),
+			["kutAppStatsBeginSession"].concat(events, ["kutAppStatsEndSession"])
+		);
+	});
+}
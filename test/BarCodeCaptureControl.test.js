@@ -0,0 +1,26 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+test("setOptions sends only the options the caller set", async () => {
+	standIn.reset();
+	standIn.on("kuiBCSetOptions", () => "KMC_SUCCESS");
+	let BarcodeCaptureControl = standIn.load("BarCodeCaptureControl");
+	let control = new BarcodeCaptureControl();
+	let parameters = control.getBarcodeCaptureControlparameters();
+	parameters.symbologies = ["QR"];
+	await new Promise((resolve, reject) => control.setOptions(resolve, reject, parameters));
+	assert.deepStrictEqual(standIn.calls("kuiBCSetOptions")[0].args, [
+		{ searchDirection: [], symbologies: ["QR"], guidingLine: "OFF" },
+	]);
+});
+
+test("getDecodeStats reports Invalid action on a native layer without it", async () => {
+	standIn.reset({ platform: "ios" });
+	let BarcodeCaptureControl = standIn.load("BarCodeCaptureControl");
+	let error = await new Promise((resolve) => new BarcodeCaptureControl().getDecodeStats(null, resolve));
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+	assert.strictEqual(standIn.calls("kuiBCGetDecodeStats").length, 0);
+});
@@ -0,0 +1,55 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+let dropped = { ErrorMsg: "KMC_LO_NETWORK_ERROR", resumable: true, submissionJobID: "job1" };
+
+test("cancelSubmission stops the automatic retry of a streaming submission", async () => {
+	standIn.reset();
+	standIn.on("kloCaptureServerSubmitDocumentStreaming", (args, reply) => reply.error(dropped));
+	standIn.on("kloCaptureServerResumeSubmission", () => ({ submissionJobID: "job1" }));
+	standIn.on("kloCaptureServerCancelSubmission", () => "KMC_SUCCESS");
+	let CaptureServer = standIn.load("CaptureServer");
+	let captureServer = new CaptureServer();
+	let outcomes = [];
+	captureServer.submitDocumentStreaming(
+		() => outcomes.push("success"),
+		(error) => outcomes.push(error.ErrorMsg),
+		{ documentID: "document1", retryDelay: 20 }
+	);
+	await standIn.settle();
+	captureServer.cancelSubmission(null, null, "job1");
+	await new Promise((resolve) => setTimeout(resolve, 50));
+	await standIn.settle();
+	assert.deepStrictEqual(outcomes, ["KMC_LO_NETWORK_ERROR"]);
+	assert.strictEqual(standIn.calls("kloCaptureServerResumeSubmission").length, 0);
+});
+
+test("submitDocumentStreaming submits in one piece on a native layer without chunked submission", async () => {
+	standIn.reset();
+	standIn.on("kloCaptureServerSubmitDocument", () => "KMC_SUCCESS");
+	let CaptureServer = standIn.load("CaptureServer");
+	let captureServer = new CaptureServer();
+	let result = await new Promise((resolve, reject) =>
+		captureServer.submitDocumentStreaming(resolve, reject, { documentID: "document1" })
+	);
+	assert.strictEqual(result, "KMC_SUCCESS");
+	assert.deepStrictEqual(standIn.calls("kloCaptureServerSubmitDocument")[0].args, ["document1"]);
+	let error = await new Promise((resolve) => captureServer.getResumableSubmissions(null, resolve));
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+});
+
+test("the submission queue reports Invalid action on a native layer without it", async () => {
+	standIn.reset({ platform: "ios" });
+	let CaptureServer = standIn.load("CaptureServer");
+	let captureServer = new CaptureServer();
+	let error = await new Promise((resolve) =>
+		captureServer.enqueueSubmission(null, resolve, { documentID: "document1" })
+	);
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+	error = await new Promise((resolve) => captureServer.getSubmissionQueueStats(null, resolve));
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+	assert.strictEqual(standIn.calls("kloCaptureServerEnqueueSubmission").length, 0);
+});
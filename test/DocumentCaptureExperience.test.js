@@ -0,0 +1,53 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+test("frameAnalysisOptions fail on a native layer without the analysis stage", async () => {
+	standIn.reset();
+	standIn.on("kuiDCTakePictureContinually", () => "KMC_SUCCESS");
+	let DocumentCaptureExperience = standIn.load("DocumentCaptureExperience");
+	let experience = new DocumentCaptureExperience();
+	let error = await new Promise((resolve) =>
+		experience.takePictureContinually(null, resolve, { maxBlurLevel: 0.3 })
+	);
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+	assert.strictEqual(standIn.calls("kuiDCTakePictureContinually").length, 0);
+	let result = await new Promise((resolve, reject) => experience.takePictureContinually(resolve, reject));
+	assert.strictEqual(result, "KMC_SUCCESS");
+	assert.deepStrictEqual(standIn.calls("kuiDCTakePictureContinually")[0].args, []);
+});
+
+test("takePictureContinually sends frameAnalysisOptions when native has the analysis stage", async () => {
+	standIn.reset();
+	standIn.on("kuiDCTakePictureContinually", () => "KMC_SUCCESS");
+	standIn.on("kuiDCGetFrameAnalysisStats", () => ({ framesAnalyzed: 0 }));
+	let DocumentCaptureExperience = standIn.load("DocumentCaptureExperience");
+	let experience = new DocumentCaptureExperience();
+	await new Promise((resolve, reject) => experience.takePictureContinually(resolve, reject, { maxBlurLevel: 0.3 }));
+	assert.deepStrictEqual(standIn.calls("kuiDCTakePictureContinually")[0].args, [{ maxBlurLevel: 0.3 }]);
+});
+
+test("once bound, takePictureContinually with frameAnalysisOptions is sent at once", async () => {
+	standIn.reset();
+	["kuiDCBindCaptureControl", "kuiDCTakePictureContinually", "kuiDCStopCapture"].forEach((action) =>
+		standIn.on(action, () => "KMC_SUCCESS")
+	);
+	standIn.on("kuiDCGetFrameAnalysisStats", () => ({ framesAnalyzed: 0 }));
+	let DocumentCaptureExperience = standIn.load("DocumentCaptureExperience");
+	let experience = new DocumentCaptureExperience();
+	await new Promise((resolve, reject) => experience.bindCaptureControl(resolve, reject, "control"));
+	let before = standIn.calls().length;
+	experience.takePictureContinually(null, null, { maxBlurLevel: 0.3 });
+	assert.strictEqual(standIn.calls().length, before + 1, "the capture call must not wait for a callback");
+	experience.stopCapture(null, null);
+	await standIn.settle();
+	assert.deepStrictEqual(
+		standIn
+			.calls()
+			.slice(before)
+			.map((call) => call.action),
+		["kuiDCTakePictureContinually", "kuiDCStopCapture"]
+	);
+});
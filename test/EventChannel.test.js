@@ -0,0 +1,83 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+// A native layer with the event channel; returns a function which sends a frame, built from [subscription index, payload] pairs
+function nativeChannel() {
+	let channel = null;
+	let eventIDs = [];
+	standIn.on("kutOpenEventChannel", (args, reply) => {
+		channel = reply;
+		return { eventType: "eventRegistered" };
+	});
+	standIn.on("kutSubscribeEvent", (args) => {
+		eventIDs.push(args[0].eventID);
+		return "KMC_SUCCESS";
+	});
+	return (events) => {
+		let frame = [];
+		events.forEach((event) => frame.push(eventIDs[event[0]], event[1]));
+		channel.success({ eventType: "eventRaised", frame: frame });
+	};
+}
+
+test("listeners of two controls keep their own subscription and get legacy results in frame order", async () => {
+	standIn.reset();
+	let sendFrame = nativeChannel();
+	let EventChannel = standIn.load("EventChannel");
+	let ImageCaptureControl = require("../www/ImageCaptureControl");
+	await new Promise((resolve, reject) => EventChannel.open(resolve, reject));
+	let first = new ImageCaptureControl();
+	let second = new ImageCaptureControl();
+	let delivered = [];
+	await new Promise((resolve, reject) =>
+		first.addLevelnessListener(resolve, reject, (r) => delivered.push("first " + r.level + " " + r.eventType))
+	);
+	await new Promise((resolve, reject) =>
+		second.addLevelnessListener(resolve, reject, (r) => delivered.push("second " + r.level))
+	);
+	let imageCallback = (r) => delivered.push("image " + r.id);
+	await new Promise((resolve, reject) =>
+		EventChannel.subscribe(resolve, reject, first, "kuiAddImageCapturedListener", imageCallback)
+	);
+	sendFrame([
+		[0, { level: 1 }],
+		[2, { id: "a" }],
+		[1, { level: 5 }],
+		[0, { level: 2 }],
+		[2, { id: "b" }],
+	]);
+	await standIn.settle();
+	assert.deepStrictEqual(delivered, ["image a", "second 5", "first 2 eventRaised", "image b"]);
+	assert.strictEqual(EventChannel.getStats().eventsCoalesced, 1);
+	assert.ok(EventChannel.isSubscribed(first, "kuiAddLevelnessListener"));
+	assert.ok(!EventChannel.isSubscribed({}, "kuiAddLevelnessListener"));
+});
+
+test("the channel cannot be opened twice", async () => {
+	standIn.reset();
+	nativeChannel();
+	let EventChannel = standIn.load("EventChannel");
+	let errors = [];
+	EventChannel.open(null, (error) => errors.push(error.ErrorMsg));
+	EventChannel.open(null, (error) => errors.push(error.ErrorMsg));
+	await standIn.settle();
+	assert.deepStrictEqual(errors, ["KMC_EVENT_CHANNEL_ALREADY_OPEN"]);
+	assert.strictEqual(standIn.calls("kutOpenEventChannel").length, 1);
+	assert.ok(EventChannel.isOpen());
+});
+
+test("listeners keep their own callbacks on a native layer without the channel", async () => {
+	standIn.reset();
+	standIn.on("kuiAddLevelnessListener", () => ({ eventType: "eventRegistered" }));
+	let EventChannel = standIn.load("EventChannel");
+	let ImageCaptureControl = require("../www/ImageCaptureControl");
+	let error = await new Promise((resolve) => EventChannel.open(null, resolve));
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+	assert.ok(!EventChannel.isOpen());
+	await new Promise((resolve, reject) => new ImageCaptureControl().addLevelnessListener(resolve, reject, () => {}));
+	assert.strictEqual(standIn.calls("kuiAddLevelnessListener").length, 1);
+	assert.strictEqual(standIn.calls("kutSubscribeEvent").length, 0);
+});
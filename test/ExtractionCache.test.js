@@ -0,0 +1,97 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+function setUp(images) {
+	standIn.reset();
+	standIn.on("kedGetImageToBase64", (args) => images[args[0]]);
+	standIn.on("kloServerExtractorGetOptions", () => ({ serverTimeout: 20 }));
+	standIn.on("kloServerExtractorExtractData", (args) => JSON.stringify({ fields: [args[0].imageIDs[0]] }));
+	let ServerExtractor = standIn.load("ServerExtractor");
+	let ExtractionCache = require("../www/ExtractionCache");
+	return { extractor: new ServerExtractor(), ExtractionCache: ExtractionCache };
+}
+
+function extract(extractor, parameters) {
+	return new Promise((resolve, reject) => extractor.extractData(resolve, reject, parameters)).then(JSON.parse);
+}
+
+function setOptions(ExtractionCache, parameters) {
+	return new Promise((resolve, reject) => ExtractionCache.setOptions(resolve, reject, parameters));
+}
+
+test("a byte identical image is answered from the cache without the server", async () => {
+	let { extractor, ExtractionCache } = setUp({ front: "AAAA" });
+	await setOptions(ExtractionCache, { enabled: true, persistent: false, cacheContext: "MobileID-1.4" });
+	let first = await extract(extractor, { imageIDs: ["front"], params: { processIdentityName: "ID" } });
+	let second = await extract(extractor, { imageIDs: ["front"], params: { processIdentityName: "ID" } });
+	assert.strictEqual(first.fromCache, undefined);
+	assert.strictEqual(second.fromCache, true);
+	assert.deepStrictEqual(second.fields, ["front"]);
+	assert.strictEqual(standIn.calls("kloServerExtractorExtractData").length, 1);
+	let stats = await new Promise((resolve, reject) => ExtractionCache.getStats(resolve, reject));
+	assert.strictEqual(stats.SERVER.hits, 1);
+	assert.strictEqual(stats.SERVER.misses, 1);
+	assert.strictEqual(stats.SERVER.entries, 1);
+});
+
+test("a changed image or project version invalidates the cached result", async () => {
+	let images = { front: "AAAA" };
+	let { extractor, ExtractionCache } = setUp(images);
+	await setOptions(ExtractionCache, { enabled: true, persistent: false, cacheContext: "MobileID-1.4" });
+	let parameters = { imageIDs: ["front"], params: { processIdentityName: "ID" } };
+	await extract(extractor, parameters);
+
+	images.front = "AAAB";
+	assert.strictEqual((await extract(extractor, parameters)).fromCache, undefined, "the image bytes changed");
+	assert.strictEqual((await extract(extractor, parameters)).fromCache, true);
+
+	await setOptions(ExtractionCache, { cacheContext: "MobileID-1.5" });
+	assert.strictEqual((await extract(extractor, parameters)).fromCache, undefined, "the project version changed");
+	let call = Object.assign({ cacheContext: "variant-2" }, parameters);
+	assert.strictEqual((await extract(extractor, call)).fromCache, undefined, "the call context changed");
+	assert.strictEqual((await extract(extractor, parameters)).fromCache, true);
+	assert.strictEqual(standIn.calls("kloServerExtractorExtractData").length, 4);
+});
+
+test("results are not cached while the cache is disabled or useCache is false", async () => {
+	let { extractor, ExtractionCache } = setUp({ front: "AAAA" });
+	await extract(extractor, { imageIDs: ["front"] });
+	await setOptions(ExtractionCache, { enabled: true, persistent: false });
+	await extract(extractor, { imageIDs: ["front"], useCache: false });
+	await extract(extractor, { imageIDs: ["front"], useCache: false });
+	assert.strictEqual(standIn.calls("kloServerExtractorExtractData").length, 3);
+	assert.strictEqual(standIn.calls("kedGetImageToBase64").length, 0);
+});
+
+test("an extraction cancelled while its images are hashed never reaches the server", async () => {
+	let { extractor, ExtractionCache } = setUp({ front: "AAAA" });
+	standIn.on("kloServerExtractorCancelExtraction", () => "KMC_SUCCESS");
+	await setOptions(ExtractionCache, { enabled: true });
+	let result = new Promise((resolve, reject) => extractor.extractData(resolve, reject, { imageIDs: ["front"] }));
+	await new Promise((resolve, reject) => extractor.cancelExtraction(resolve, reject));
+	assert.strictEqual(await result, null);
+	assert.strictEqual(standIn.calls("kedGetImageToBase64").length, 1);
+	assert.strictEqual(standIn.calls("kloServerExtractorExtractData").length, 0);
+});
+
+test("results stay out of localStorage unless persistent is set", async () => {
+	let stored = {};
+	global.localStorage = {
+		getItem: (key) => (key in stored ? stored[key] : null),
+		setItem: (key, value) => (stored[key] = value),
+	};
+	try {
+		let { extractor, ExtractionCache } = setUp({ front: "AAAA" });
+		await setOptions(ExtractionCache, { enabled: true });
+		await extract(extractor, { imageIDs: ["front"] });
+		assert.deepStrictEqual(stored, {});
+		await setOptions(ExtractionCache, { persistent: true });
+		await extract(extractor, { imageIDs: ["front"], params: { retry: 1 } });
+		assert.deepStrictEqual(Object.keys(stored), ["kfxCordova.ExtractionCache"]);
+	} finally {
+		delete global.localStorage;
+	}
+});
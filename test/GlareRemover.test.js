@@ -0,0 +1,79 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+function setUp() {
+	standIn.reset({ latencyMs: 5 });
+	standIn.on("kenGRStartFusion", () => ({ fusionID: "fusion1" }));
+	standIn.on("kenGRAddFusionFrame", () => ({ framesMerged: 1, residualGlareFraction: 0.1 }));
+	let GlareRemover = standIn.load("GlareRemover");
+	return new GlareRemover();
+}
+
+test("frames added before startGlareFusion calls back carry the fusion ID", async () => {
+	let glareRemover = setUp();
+	let order = [];
+	glareRemover.startGlareFusion(() => order.push("started"), null);
+	glareRemover.addGlareFusionFrame(() => order.push("frame1"), null, "image1");
+	glareRemover.addGlareFusionFrame(() => order.push("frame2"), null, "image2");
+	await standIn.settle();
+	assert.deepStrictEqual(
+		standIn.calls("kenGRAddFusionFrame").map((call) => call.args),
+		[
+			["fusion1", "image1"],
+			["fusion1", "image2"],
+		]
+	);
+	assert.deepStrictEqual(order, ["started", "frame1", "frame2"]);
+});
+
+test("a failed finishGlareFusion can be retried", async () => {
+	let glareRemover = setUp();
+	let attempts = 0;
+	standIn.on("kenGRFinishFusion", (args, reply) => {
+		if (++attempts === 1) {
+			reply.error({ ErrorMsg: "KMC_EXCEPTION" });
+			return undefined;
+		}
+		return "image9";
+	});
+	await new Promise((resolve, reject) => glareRemover.startGlareFusion(resolve, reject));
+	let error = await new Promise((resolve) => glareRemover.finishGlareFusion(null, resolve));
+	assert.strictEqual(error.ErrorMsg, "KMC_EXCEPTION");
+	await new Promise((resolve, reject) => glareRemover.finishGlareFusion(resolve, reject));
+	assert.deepStrictEqual(
+		standIn.calls("kenGRFinishFusion").map((call) => call.args),
+		[["fusion1"], ["fusion1"]]
+	);
+	assert.strictEqual(glareRemover.fusionID, null);
+});
+
+test("getGlareFractions analyses each image on its own without kenGRGetGlareFractions", async () => {
+	let glareRemover = setUp();
+	standIn.on("kenGRGetGlareFraction", (args) => ({ image1: 0.2, image2: 0.05 })[args[0]]);
+	let result = await new Promise((resolve, reject) =>
+		glareRemover.getGlareFractions(resolve, reject, ["image1", "image2"], { tileSize: 64 })
+	);
+	assert.deepStrictEqual(result, [0.2, 0.05]);
+	assert.deepStrictEqual(
+		standIn.calls("kenGRGetGlareFraction").map((call) => call.args),
+		[
+			["image1", { tileSize: 64 }],
+			["image2", { tileSize: 64 }],
+		]
+	);
+});
+
+test("a second startGlareFusion is rejected while a fusion is in progress", async () => {
+	let glareRemover = setUp();
+	glareRemover.startGlareFusion(null, null);
+	let error = await new Promise((resolve) => glareRemover.startGlareFusion(null, resolve));
+	assert.strictEqual(error.ErrorMsg, "KMC_GR_FUSION_IN_PROGRESS");
+	await standIn.settle();
+	error = await new Promise((resolve) => glareRemover.startGlareFusion(null, resolve));
+	assert.strictEqual(error.ErrorMsg, "KMC_GR_FUSION_IN_PROGRESS");
+	assert.strictEqual(standIn.calls("kenGRStartFusion").length, 1);
+	assert.strictEqual(glareRemover.fusionID, "fusion1");
+});
@@ -0,0 +1,95 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+let released = (args) => ({ released: args[0].image.length });
+
+function report(HandleRegistry) {
+	return new Promise((resolve, reject) => HandleRegistry.getLiveObjectReport(resolve, reject));
+}
+
+test("an ID first carried by an object created before automatic release is never released", async () => {
+	standIn.reset();
+	standIn.on("kutReleaseHandles", released);
+	let HandleRegistry = standIn.load("HandleRegistry");
+	HandleRegistry.track({}, "image", "early");
+	HandleRegistry.setAutoRelease({ images: true });
+	HandleRegistry.track({}, "image", "early");
+	HandleRegistry.track({}, "image", "late");
+	HandleRegistry.unreference("image", "early");
+	HandleRegistry.unreference("image", "late");
+	await standIn.settle();
+	let releases = standIn.calls("kutReleaseHandles");
+	assert.strictEqual(releases.length, 1);
+	assert.deepStrictEqual(releases[0].args[0].image, ["late"]);
+});
+
+test("raw IDs returned by getImageIDs are pinned", async () => {
+	standIn.reset();
+	standIn.on("kutReleaseHandles", released);
+	standIn.on("kedGetImageIds", () => ["raw"]);
+	let ImageArray = standIn.load("ImageArray");
+	let HandleRegistry = require("../www/HandleRegistry");
+	HandleRegistry.setAutoRelease({ images: true });
+	HandleRegistry.track({}, "image", "raw");
+	await new Promise((resolve, reject) => new ImageArray().getImageIDs(resolve, reject));
+	HandleRegistry.unreference("image", "raw");
+	await standIn.settle();
+	assert.strictEqual(standIn.calls("kutReleaseHandles").length, 0);
+});
+
+test("failed releases are counted in the live object report", async () => {
+	standIn.reset();
+	let HandleRegistry = standIn.load("HandleRegistry");
+	HandleRegistry.setAutoRelease({ images: true });
+	HandleRegistry.track({}, "image", "a");
+	HandleRegistry.track({}, "image", "b");
+	HandleRegistry.unreference("image", "a");
+	await standIn.settle();
+	let result = await report(HandleRegistry);
+	assert.strictEqual(result.releaseFailedCount, 1);
+	assert.strictEqual(result.lastReleaseError.ErrorMsg, "Invalid action");
+	assert.deepStrictEqual(result.objects, [{ kind: "image", id: "b", jsReferences: 1 }]);
+});
+
+test("removing images drops their pins", async () => {
+	standIn.reset();
+	standIn.on("kutReleaseHandles", released);
+	standIn.on("kedGetImageIds", () => ["raw"]);
+	standIn.on("kedRemoveImages", () => "KMC_SUCCESS");
+	let ImageArray = standIn.load("ImageArray");
+	let HandleRegistry = require("../www/HandleRegistry");
+	let imageArray = new ImageArray();
+	HandleRegistry.setAutoRelease({ images: true });
+	await new Promise((resolve, reject) => imageArray.getImageIDs(resolve, reject));
+	await new Promise((resolve, reject) => imageArray.removeImages(resolve, reject, ["raw"]));
+	HandleRegistry.track({}, "image", "raw");
+	HandleRegistry.unreference("image", "raw");
+	await standIn.settle();
+	let releases = standIn.calls("kutReleaseHandles");
+	assert.strictEqual(releases.length, 1);
+	assert.deepStrictEqual(releases[0].args[0].image, ["raw"]);
+});
+
+test("the IDs of a document graph are pinned", async () => {
+	standIn.reset();
+	standIn.on("kutReleaseHandles", released);
+	standIn.on("kloGetDocumentGraph", () => ({
+		version: 1,
+		documentIDs: ["d1"],
+		documents: [{ documentID: "d1", documentType: {}, pageIDs: ["p1"] }],
+		pages: [{ pageID: "p1", images: [{ ID: "i1" }] }],
+	}));
+	let DocumentsArray = standIn.load("DocumentsArray");
+	let HandleRegistry = require("../www/HandleRegistry");
+	HandleRegistry.setAutoRelease({ images: true, pages: true, documents: true });
+	let graph = await new Promise((resolve, reject) => new DocumentsArray().getDocumentGraph(resolve, reject));
+	assert.strictEqual(graph.documents[0].pages[0].images[0].imgID, "i1");
+	HandleRegistry.unreference("document", "d1");
+	HandleRegistry.unreference("page", "p1");
+	HandleRegistry.unreference("image", "i1");
+	await standIn.settle();
+	assert.strictEqual(standIn.calls("kutReleaseHandles").length, 0);
+});
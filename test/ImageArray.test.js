@@ -0,0 +1,110 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+let bytes = (length) => new Uint8Array(length).map((value, index) => index % 251).buffer;
+
+test("getImageFromArrayBuffer converts through getImageFromBase64 on the native layer shipped in lib/", async () => {
+	standIn.reset();
+	let received;
+	standIn.on("kedGetImageFromBase64", (args) => {
+		received = Buffer.from(args[0], "base64");
+		return { ID: "image1" };
+	});
+	let ImageArray = standIn.load("ImageArray");
+	let image = await new Promise((resolve, reject) => {
+		new ImageArray().getImageFromArrayBuffer(resolve, reject, bytes(1000));
+	});
+	assert.strictEqual(image.imgID, "image1");
+	assert.deepStrictEqual(received, Buffer.from(bytes(1000)));
+});
+
+test("getImageFromArrayBuffer sends large buffers in ordered chunks when native supports them", async () => {
+	standIn.reset();
+	let chunks = [];
+	standIn.on("kedAppendImageChunk", (args) => {
+		chunks.push({ offset: args[0].offset, length: args[1].byteLength, last: args[0].last });
+		return args[0].last ? { ID: "image1" } : "KMC_SUCCESS";
+	});
+	let ImageArray = standIn.load("ImageArray");
+	let imageArray = new ImageArray();
+	imageArray.setBinaryTransferOptions({ chunkThreshold: 100, chunkSize: 400 });
+	await new Promise((resolve, reject) => imageArray.getImageFromArrayBuffer(resolve, reject, bytes(1000)));
+	assert.deepStrictEqual(chunks, [
+		{ offset: 0, length: 400, last: false },
+		{ offset: 400, length: 400, last: false },
+		{ offset: 800, length: 200, last: true },
+	]);
+});
+
+test("getImageAsBlobChunks splits getImageAsBlob on the native layer shipped in lib/", async () => {
+	standIn.reset();
+	standIn.on("kedGetImageAsBlob", () => bytes(1000));
+	let ImageArray = standIn.load("ImageArray");
+	let imageArray = new ImageArray();
+	imageArray.setBinaryTransferOptions({ chunkSize: 400 });
+	let offsets = [];
+	let total = await new Promise((resolve, reject) => {
+		imageArray.getImageAsBlobChunks(resolve, reject, "image1", (chunk, offset) => {
+			offsets.push([offset, chunk.byteLength]);
+		});
+	});
+	assert.strictEqual(total, 1000);
+	assert.deepStrictEqual(offsets, [
+		[0, 400],
+		[400, 400],
+		[800, 200],
+	]);
+});
+
+let outputs = [
+	{ filePath: "page1.jpg", jpegQuality: 90 },
+	{ filePath: "page1_extraction.tif", format: "TIFF_G4", maxDimension: 2000, dpi: 200 },
+];
+
+function writeOutputs(ImageArray) {
+	return new Promise((resolve, reject) =>
+		new ImageArray().imageWriteToFile(resolve, reject, { imageID: "image1", outputs: outputs })
+	);
+}
+
+test("imageWriteToFile writes each output with its own call on the native layer shipped in lib/", async () => {
+	standIn.reset();
+	standIn.on("kedGetImageProperties", () => ({ mimeType: "MIMETYPE_JPEG", dpi: 300, jpegQuality: 95 }));
+	standIn.on("kedSetImageProperties", () => "KMC_SUCCESS");
+	standIn.on("kedImageWriteToFile", () => "KMC_SUCCESS");
+	let ImageArray = standIn.load("ImageArray");
+	let results = await writeOutputs(ImageArray);
+	assert.deepStrictEqual(results, [{ filePath: "page1.jpg" }, { filePath: "page1_extraction.tif" }]);
+	assert.deepStrictEqual(
+		standIn.calls("kedImageWriteToFile").map((call) => call.args[0]),
+		[
+			{ imageID: "image1", filePath: "page1.jpg" },
+			{ imageID: "image1", filePath: "page1_extraction.tif" },
+		]
+	);
+	assert.deepStrictEqual(
+		standIn.calls("kedSetImageProperties").map((call) => call.args[0]),
+		[
+			{ imageID: "image1", mimeType: "MIMETYPE_JPEG", dpi: 300, jpegQuality: 90 },
+			{ imageID: "image1", mimeType: "MIMETYPE_TIFF", dpi: 200, jpegQuality: 95 },
+			{ imageID: "image1", mimeType: "MIMETYPE_JPEG", dpi: 300, jpegQuality: 95 },
+		]
+	);
+});
+
+test("imageWriteToFile sends every output in one call when native has kedImageWriteToFiles", async () => {
+	standIn.reset();
+	standIn.on("kedImageWriteToFiles", (args) =>
+		args[0].outputs.map((output) => ({ filePath: output.filePath, width: 10, height: 10, fileSize: 100 }))
+	);
+	let ImageArray = standIn.load("ImageArray");
+	let results = await writeOutputs(ImageArray);
+	assert.strictEqual(results.length, 2);
+	assert.strictEqual(results[1].filePath, "page1_extraction.tif");
+	assert.strictEqual(standIn.calls("kedImageWriteToFiles").length, 1);
+	assert.deepStrictEqual(standIn.calls("kedImageWriteToFiles")[0].args[0].outputs, outputs);
+	assert.strictEqual(standIn.calls("kedImageWriteToFile").length, 0);
+});
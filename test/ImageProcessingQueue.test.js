@@ -0,0 +1,130 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+// The ImageProcessor actions of the native layer shipped in lib/: one image at a time, results through the imageOut listener
+function serialImageProcessor() {
+	let imageOut = null;
+	standIn.on("kenImageProcessorAddImageOutEventListener", (args, reply) => {
+		imageOut = reply;
+		return { eventType: "eventRegistered" };
+	});
+	standIn.on("kenImageProcessorRemoveImageOutEventListener", () => "KMC_SUCCESS");
+	standIn.on("kenImageProcessorSetOptions", () => "KMC_SUCCESS");
+	standIn.on("kenProcessImage", (args) => {
+		setTimeout(() => imageOut.success({ eventType: "eventRaised", ID: "processed_" + args[0] }), 1);
+		return "KMC_SUCCESS";
+	});
+	standIn.on("kenCancelImageProcess", () => "KMC_SUCCESS");
+}
+
+function addJob(queue, imageID, priority, outcomes) {
+	queue.addJob(
+		(result) => outcomes.push(result.image.imgID),
+		(error) => outcomes.push(error.error.ErrorMsg),
+		{ imageID: imageID, priority: priority }
+	);
+}
+
+test("jobs run one at a time in priority order on a native layer without kenProcessImageBatch", async () => {
+	standIn.reset();
+	serialImageProcessor();
+	let ImageProcessingQueue = standIn.load("ImageProcessingQueue");
+	let queue = new ImageProcessingQueue({ concurrency: 4 });
+	let outcomes = [];
+	addJob(queue, "a", 0, outcomes);
+	addJob(queue, "b", 5, outcomes);
+	addJob(queue, "c", 0, outcomes);
+	await new Promise((resolve) => setTimeout(resolve, 50));
+	await standIn.settle();
+	assert.deepStrictEqual(outcomes, ["processed_b", "processed_a", "processed_c"]);
+	assert.deepStrictEqual(
+		standIn.calls("kenProcessImage").map((call) => call.args[0]),
+		["b", "a", "c"]
+	);
+	assert.strictEqual(standIn.calls("kenImageProcessorAddImageOutEventListener").length, 1);
+	assert.strictEqual(standIn.calls("kenImageProcessorRemoveImageOutEventListener").length, 1);
+	assert.strictEqual(queue.getOutstandingJobCount(), 0);
+});
+
+test("cancelled jobs report KMC_EV_USER_ABORT as an error object", async () => {
+	standIn.reset();
+	serialImageProcessor();
+	let ImageProcessingQueue = standIn.load("ImageProcessingQueue");
+	let queue = new ImageProcessingQueue();
+	let errors = [];
+	queue.addJob(null, (error) => errors.push(error), { imageID: "a" });
+	queue.cancelJobs(null, null);
+	await standIn.settle();
+	assert.deepStrictEqual(errors.length, 1);
+	assert.strictEqual(errors[0].error.ErrorMsg, "KMC_EV_USER_ABORT");
+	assert.strictEqual(typeof errors[0].error.ErrorDesc, "string");
+	assert.strictEqual(standIn.calls("kenProcessImage").length, 0);
+});
+
+test("jobs go to kenProcessImageBatch when native implements it", async () => {
+	standIn.reset();
+	standIn.on("kenProcessImageBatch", (args, reply) => {
+		args[0].jobs.forEach((job) => {
+			reply.success({ eventType: "eventRaised", jobID: job.jobID, image: { ID: "processed_" + job.imageID } });
+		});
+	});
+	let ImageProcessingQueue = standIn.load("ImageProcessingQueue");
+	let queue = new ImageProcessingQueue();
+	let outcomes = [];
+	addJob(queue, "a", 0, outcomes);
+	addJob(queue, "b", 0, outcomes);
+	await new Promise((resolve) => setTimeout(resolve, 10));
+	await standIn.settle();
+	assert.deepStrictEqual(outcomes, ["processed_a", "processed_b"]);
+	assert.strictEqual(standIn.calls("kenProcessImageBatch").length, 1);
+	assert.strictEqual(standIn.calls("kenProcessImage").length, 0);
+});
+
+test("the serial fallback gives the imageOut listener and options back to the app", async () => {
+	standIn.reset();
+	serialImageProcessor();
+	standIn.on("kenImageProcessorGetOptions", () => ({ profile: "app" }));
+	let ImageProcessingQueue = standIn.load("ImageProcessingQueue");
+	let ImageProcessor = require("../www/ImageProcessor");
+	let appImages = [];
+	new ImageProcessor().addImageOutEventListener(null, null, (image) => appImages.push(image.imgID));
+	let queue = new ImageProcessingQueue();
+	let outcomes = [];
+	queue.addJob(
+		(result) => outcomes.push(result.image.imgID),
+		null,
+		{ imageID: "a", imageProcessingOptions: { profile: "job" } }
+	);
+	await new Promise((resolve) => setTimeout(resolve, 20));
+	await standIn.settle();
+	assert.deepStrictEqual(outcomes, ["processed_a"]);
+	assert.deepStrictEqual(appImages, []);
+	assert.deepStrictEqual(
+		standIn.calls("kenImageProcessorSetOptions").map((call) => call.args[0].profile),
+		["job", "app"]
+	);
+	assert.strictEqual(standIn.calls("kenImageProcessorRemoveImageOutEventListener").length, 0);
+	new ImageProcessor().processImage(null, null, "b");
+	await new Promise((resolve) => setTimeout(resolve, 20));
+	await standIn.settle();
+	assert.deepStrictEqual(appImages, ["processed_b"]);
+});
+
+test("jobs sent while the native capabilities are unknown can be cancelled", async () => {
+	standIn.reset({ latencyMs: (action) => (action === "kutGetNativeCapabilities" ? 20 : 0) });
+	serialImageProcessor();
+	let ImageProcessingQueue = standIn.load("ImageProcessingQueue");
+	let queue = new ImageProcessingQueue();
+	let outcomes = [];
+	["a", "b", "c"].forEach((imageID) => addJob(queue, imageID, 0, outcomes));
+	await Promise.resolve();
+	queue.cancelJobs(null, null);
+	await new Promise((resolve) => setTimeout(resolve, 40));
+	await standIn.settle();
+	assert.deepStrictEqual(outcomes, ["KMC_EV_USER_ABORT", "KMC_EV_USER_ABORT", "KMC_EV_USER_ABORT"]);
+	assert.ok(standIn.calls("kenProcessImage").length <= 1);
+	assert.strictEqual(queue.getOutstandingJobCount(), 0);
+});
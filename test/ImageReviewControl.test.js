@@ -0,0 +1,48 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+let first = [{ left: 1, top: 1, width: 10, height: 10 }];
+let second = [{ left: 20, top: 20, width: 10, height: 10 }];
+
+function nextFrame() {
+	return new Promise((resolve) => setTimeout(resolve, 40)).then(standIn.settle);
+}
+
+test("highlights stay unbatched when native cannot take the rendering options", async () => {
+	standIn.reset();
+	standIn.on("kuiShowHighlights", () => "KMC_SUCCESS");
+	let ImageReviewControl = standIn.load("ImageReviewControl");
+	let control = new ImageReviewControl();
+	let error = await new Promise((resolve) => control.setRenderingOptions(null, resolve, { batchHighlights: true }));
+	assert.strictEqual(error.ErrorMsg, "Invalid action");
+	await new Promise((resolve, reject) => control.showHighlights(resolve, reject, first));
+	assert.deepStrictEqual(standIn.calls("kuiShowHighlights")[0].args, [first]);
+	assert.strictEqual(standIn.calls("kuiUpdateHighlights").length, 0);
+});
+
+test("the last highlight call of a frame decides the overlay update", async () => {
+	standIn.reset();
+	standIn.on("kuiSetImageReviewRenderingOptions", () => "KMC_SUCCESS");
+	standIn.on("kuiUpdateHighlights", () => "KMC_SUCCESS");
+	let ImageReviewControl = standIn.load("ImageReviewControl");
+	let control = new ImageReviewControl();
+	await new Promise((resolve, reject) => control.setRenderingOptions(resolve, reject, { batchHighlights: true }));
+	let results = [];
+	control.showHighlights((result) => results.push(result), null, first);
+	control.showHighlights((result) => results.push(result), null, second);
+	await nextFrame();
+	control.showHighlights((result) => results.push(result), null, first);
+	control.clearHighlights((result) => results.push(result), null);
+	await nextFrame();
+	assert.deepStrictEqual(
+		standIn.calls("kuiUpdateHighlights").map((call) => call.args[0]),
+		[
+			{ clear: true, highlights: second },
+			{ clear: true, highlights: [] },
+		]
+	);
+	assert.strictEqual(results.length, 4);
+});
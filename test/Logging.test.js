@@ -0,0 +1,73 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+// Collects what Logging writes to the console while fn runs
+async function capturingConsole(fn) {
+	let lines = [];
+	let original = console.log;
+	console.log = (line) => lines.push(line);
+	try {
+		await fn();
+	} finally {
+		console.log = original;
+	}
+	return lines;
+}
+
+test("records go to the console on a native layer without kutWriteLogRecords", async () => {
+	standIn.reset();
+	let Logging = standIn.load("Logging");
+	let logging = new Logging();
+	let lines = await capturingConsole(async () => {
+		assert.strictEqual(logging.log("CAPTURE", "INFO", "frame analysed"), true);
+		let result = await new Promise((resolve, reject) => logging.flushLogs(resolve, reject));
+		assert.strictEqual(result, "KMC_SUCCESS");
+	});
+	assert.strictEqual(lines.length, 1);
+	assert.match(lines[0], / INFO \[CAPTURE\] frame analysed$/);
+});
+
+test("a failed kutWriteLogRecords reaches the flushLogs errorCallback once and is counted", async () => {
+	standIn.reset();
+	standIn.on("kutWriteLogRecords", (args, reply) => reply.error({ ErrorMsg: "KMC_EXCEPTION" }));
+	standIn.on("kutFlushLogs", (args, reply) => reply.error({ ErrorMsg: "KMC_EXCEPTION" }));
+	let Logging = standIn.load("Logging");
+	let logging = new Logging();
+	let errors = [];
+	await capturingConsole(async () => {
+		logging.log("LOGISTICS", "INFO", "submitted");
+		logging.flushLogs(null, (error) => errors.push(error.ErrorMsg));
+		await new Promise((resolve) => setTimeout(resolve, 10));
+		await standIn.settle();
+	});
+	assert.deepStrictEqual(errors, ["KMC_EXCEPTION"]);
+	let stats = await new Promise((resolve, reject) => logging.getLoggingStats(resolve, reject));
+	assert.strictEqual(stats.LOGISTICS.failed, 1);
+});
+
+test("queueCapacity counts the records native has not taken yet", async () => {
+	standIn.reset({ latencyMs: 20 });
+	standIn.on("kutSetLoggingOptions", () => "KMC_SUCCESS");
+	standIn.on("kutWriteLogRecords", () => "KMC_SUCCESS");
+	let Logging = standIn.load("Logging");
+	let logging = new Logging();
+	await new Promise((resolve, reject) =>
+		logging.setLoggingOptions(resolve, reject, { queueCapacity: 4, batchSize: 2 })
+	);
+	let queued = [];
+	for (let i = 0; i < 6; i++) queued.push(logging.log("CAPTURE", "INFO", "record " + i));
+	assert.deepStrictEqual(queued, [true, true, true, true, false, false]);
+	await standIn.settle();
+	assert.strictEqual(logging.log("CAPTURE", "INFO", "after"), true);
+});
+
+test("setLoggingOptions accepts no options", async () => {
+	standIn.reset();
+	standIn.on("kutSetLoggingOptions", () => "KMC_SUCCESS");
+	let Logging = standIn.load("Logging");
+	let result = await new Promise((resolve, reject) => new Logging().setLoggingOptions(resolve, reject));
+	assert.strictEqual(result, "KMC_SUCCESS");
+});
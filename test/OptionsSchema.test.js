@@ -0,0 +1,94 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+let options = () => ({ LookAndFeel: { vibrationEnabled: true }, CaptureCriteria: { stabilityThreshold: 95 } });
+
+function setUp(withDelta) {
+	standIn.reset();
+	standIn.on("kuiDCSetOptions", () => "KMC_SUCCESS");
+	standIn.on("kuiDCBindCaptureControl", () => "KMC_SUCCESS");
+	if (withDelta) standIn.on("kuiDCSetOptionsDelta", () => ({ cameraReconfigured: false }));
+	let DocumentCaptureExperience = standIn.load("DocumentCaptureExperience");
+	return new DocumentCaptureExperience();
+}
+
+function setOptions(experience, parameters) {
+	return new Promise((resolve, reject) => experience.setOptions(resolve, reject, parameters));
+}
+
+test("setOptions always sends the whole options on a native layer without the delta action", async () => {
+	let experience = setUp(false);
+	await setOptions(experience, options());
+	await setOptions(experience, options());
+	let changed = options();
+	changed.LookAndFeel.vibrationEnabled = false;
+	await setOptions(experience, changed);
+	let calls = standIn.calls("kuiDCSetOptions");
+	assert.strictEqual(calls.length, 3);
+	assert.deepStrictEqual(calls[2].args, [changed]);
+});
+
+test("setOptions sends only the changed paths when native has the delta action", async () => {
+	let experience = setUp(true);
+	await setOptions(experience, options());
+	assert.strictEqual(await setOptions(experience, options()), "KMC_SUCCESS");
+	let changed = options();
+	changed.LookAndFeel.vibrationEnabled = false;
+	await setOptions(experience, changed);
+	assert.strictEqual(standIn.calls("kuiDCSetOptions").length, 1);
+	let deltas = standIn.calls("kuiDCSetOptionsDelta");
+	assert.strictEqual(deltas.length, 1);
+	assert.deepStrictEqual(deltas[0].args, [[{ path: ["LookAndFeel", "vibrationEnabled"], value: false }]]);
+});
+
+test("a delta answered with Invalid action is sent again as the whole options", async () => {
+	let experience = setUp(true);
+	let ActionUtils = require("../www/ActionUtils");
+	await new Promise((resolve) => ActionUtils.isActionSupported("kuiDCSetOptionsDelta", resolve));
+	await setOptions(experience, options());
+	standIn.off("kuiDCSetOptionsDelta");
+	let changed = options();
+	changed.CaptureCriteria.stabilityThreshold = 90;
+	await setOptions(experience, changed);
+	let calls = standIn.calls("kuiDCSetOptions");
+	assert.strictEqual(calls.length, 2);
+	assert.deepStrictEqual(calls[1].args, [changed]);
+	assert.strictEqual(standIn.calls("kuiDCSetOptionsDelta").length, 1);
+});
+
+test("options native converts itself, and a new binding, go out as the whole options", async () => {
+	let experience = setUp(true);
+	await setOptions(experience, options());
+	let converted = options();
+	converted.CaptureCriteria.stabilityThreshold = "95";
+	await setOptions(experience, converted);
+	assert.deepStrictEqual(standIn.calls("kuiDCSetOptions")[1].args, [converted]);
+
+	await setOptions(experience, options());
+	await new Promise((resolve, reject) => experience.bindCaptureControl(resolve, reject, "control1"));
+	await setOptions(experience, options());
+	assert.strictEqual(standIn.calls("kuiDCSetOptions").length, 4);
+	assert.strictEqual(standIn.calls("kuiDCSetOptionsDelta").length, 0);
+});
+
+test("a capture started right after setOptions reaches native after the options", async () => {
+	standIn.reset({ latencyMs: (action) => (action === "kutGetNativeCapabilities" ? 50 : 0) });
+	standIn.on("kuiDCSetOptions", () => "KMC_SUCCESS");
+	standIn.on("kuiDCSetOptionsDelta", () => ({ cameraReconfigured: false }));
+	standIn.on("kuiDCTakePictureContinually", () => "KMC_SUCCESS");
+	let DocumentCaptureExperience = standIn.load("DocumentCaptureExperience");
+	let ActionUtils = require("../www/ActionUtils");
+	let experience = new DocumentCaptureExperience();
+	await setOptions(experience, options());
+	let changed = options();
+	changed.CaptureCriteria.stabilityThreshold = 90;
+	experience.setOptions(null, null, changed);
+	ActionUtils.exec(null, null, ActionUtils.serviceName, "kuiDCTakePictureContinually", []);
+	await standIn.settle();
+	let order = standIn.calls().map((call) => call.action);
+	assert.ok(order.indexOf("kuiDCSetOptionsDelta") >= 0);
+	assert.ok(order.indexOf("kuiDCSetOptionsDelta") < order.indexOf("kuiDCTakePictureContinually"));
+});
@@ -0,0 +1,75 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+test("promisify uses the registered method list, whatever the parameter names", async () => {
+	standIn.reset();
+	standIn.on("kenProcessImage", () => "KMC_SUCCESS");
+	let PromiseUtils = standIn.load("PromiseUtils");
+	let ImageProcessor = require("../www/ImageProcessor");
+	let processImage = ImageProcessor.prototype.processImage;
+	// What a minifier leaves of the method: the same body behind renamed parameters
+	ImageProcessor.prototype.processImage = function (a, b, c) {
+		return processImage.call(this, a, b, c);
+	};
+	let processor = PromiseUtils.promisify(new ImageProcessor());
+	let result = processor.processImage("image1");
+	assert.ok(result instanceof Promise);
+	assert.strictEqual(await result, "KMC_SUCCESS");
+	assert.strictEqual(typeof processor.getImageProcessingOptions(), "object");
+});
+
+test("aborting a promisified call rejects with the plugin error shape and calls the cancel method", async () => {
+	standIn.reset();
+	standIn.on("kenProcessImage", () => undefined);
+	standIn.on("kenCancelImageProcess", () => "KMC_SUCCESS");
+	let PromiseUtils = standIn.load("PromiseUtils");
+	let ImageProcessor = require("../www/ImageProcessor");
+	let processor = PromiseUtils.promisify(new ImageProcessor());
+	let controller = new AbortController();
+	let pending = processor.processImage("image1", PromiseUtils.callOptions({ signal: controller.signal }));
+	controller.abort();
+	await assert.rejects(pending, { ErrorMsg: "KMC_EV_USER_ABORT" });
+	assert.strictEqual(standIn.calls("kenCancelImageProcess").length, 1);
+});
+
+test("promisify takes an explicit method list for objects which are not plugin classes", async () => {
+	standIn.reset();
+	let PromiseUtils = standIn.load("PromiseUtils");
+	let custom = {
+		fetch: function (ok, fail, value) {
+			setImmediate(() => ok(value * 2));
+		},
+	};
+	let facade = PromiseUtils.promisify(custom, ["fetch"]);
+	assert.strictEqual(await facade.fetch(21), 42);
+});
+
+test("aborting a promisified submitDocument cancels the submission in progress", async () => {
+	standIn.reset();
+	standIn.on("kloCaptureServeraddProgressListener", (args, reply) => {
+		reply.success({ eventType: "eventRegistered" });
+		setImmediate(() => reply.success({ eventType: "eventRaised", submissionJobID: "job7", progressPercent: 1 }));
+		return undefined;
+	});
+	standIn.on("kloCaptureServerSubmitDocument", () => undefined);
+	standIn.on("kloCaptureServerCancelSubmission", () => "KMC_SUCCESS");
+	let PromiseUtils = standIn.load("PromiseUtils");
+	let CaptureServer = require("../www/CaptureServer");
+	let captureServer = new CaptureServer();
+	await new Promise((resolve, reject) => captureServer.addProgressListener(resolve, reject, null));
+	let controller = new AbortController();
+	let pending = PromiseUtils.promisify(captureServer).submitDocument(
+		"document1",
+		PromiseUtils.callOptions({ signal: controller.signal })
+	);
+	await standIn.settle();
+	controller.abort();
+	await assert.rejects(pending, { ErrorMsg: "KMC_EV_USER_ABORT" });
+	assert.deepStrictEqual(
+		standIn.calls("kloCaptureServerCancelSubmission").map((call) => call.args),
+		[["job7"]]
+	);
+});
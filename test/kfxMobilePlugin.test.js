@@ -0,0 +1,54 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let standIn = require("./support/nativeStandIn");
+
+function startupReport(kfxCordova) {
+	return new Promise((resolve, reject) => kfxCordova.getStartupReport(resolve, reject));
+}
+
+test("the startup report has only the JavaScript part on the native layer in lib/", async () => {
+	standIn.reset();
+	let kfxCordova = standIn.load("kfxMobilePlugin");
+	let before = await startupReport(kfxCordova);
+	assert.deepStrictEqual(Object.keys(before), ["js"]);
+	assert.ok(before.js.pluginEvalMs >= 0);
+	assert.deepStrictEqual(before.js.modules, []);
+	new kfxCordova.ImageArray();
+	let after = await startupReport(kfxCordova);
+	assert.deepStrictEqual(after.js.modules.map((entry) => entry.module), ["ImageArray"]);
+});
+
+test("the native part is merged when native implements kutGetStartupReport", async () => {
+	standIn.reset();
+	let subsystems = { nfc: { initialized: false, initMs: 0, firstCallTime: null } };
+	standIn.on("kutGetStartupReport", () => ({ pluginInitMs: 12, subsystems: subsystems }));
+	let kfxCordova = standIn.load("kfxMobilePlugin");
+	let report = await startupReport(kfxCordova);
+	assert.deepStrictEqual(report.native, { pluginInitMs: 12, subsystems: subsystems });
+	assert.deepStrictEqual(report.js.modules, []);
+});
+
+test("a plugin module is required on its first use and only once", () => {
+	standIn.reset();
+	let Module = require("module");
+	let originalLoad = Module._load;
+	let required = [];
+	Module._load = function (request) {
+		if (request.indexOf("./kfxMobilePlugin.") === 0) required.push(request.slice("./kfxMobilePlugin.".length));
+		return originalLoad.apply(this, arguments);
+	};
+	try {
+		let kfxCordova = standIn.load("kfxMobilePlugin");
+		assert.ok(required.indexOf("ActionUtils") >= 0);
+		assert.strictEqual(required.indexOf("ImageArray"), -1, "not required before its first use");
+		let first = new kfxCordova.ImageArray();
+		let second = new kfxCordova.ImageArray();
+		assert.strictEqual(required.filter((name) => name === "ImageArray").length, 1);
+		assert.strictEqual(Object.getPrototypeOf(first), Object.getPrototypeOf(second));
+		assert.strictEqual(typeof first.removeImages, "function");
+	} finally {
+		Module._load = originalLoad;
+	}
+});
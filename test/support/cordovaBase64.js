@@ -0,0 +1,10 @@
+"use strict";
+
+// Resolved in place of cordova/base64, which the www modules share with cordova/exec
+module.exports = {
+	fromArrayBuffer: (arrayBuffer) => Buffer.from(arrayBuffer).toString("base64"),
+	toArrayBuffer: (str) => {
+		let bytes = Buffer.from(str, "base64");
+		return bytes.buffer.slice(bytes.byteOffset, bytes.byteOffset + bytes.byteLength);
+	},
+};
@@ -0,0 +1,6 @@
+"use strict";
+
+// Resolved in place of cordova/exec while the www modules run under the native stand-in
+module.exports = function () {
+	return require("./nativeStandIn").exec.apply(null, arguments);
+};
@@ -0,0 +1,152 @@
+"use strict";
+
+// Stand-in for the native kfxPlugin, used to run the www modules in Node.
+//
+// The www modules reach native only through require("cordova/exec"). A resolver maps that module, cordova/base64 and the
+// "./kfxMobilePlugin.X" ids used by the plugin entry module, so the modules run unchanged; load() returns a fresh copy of them.
+// Actions answer through handlers registered with on(). Actions without a handler behave as on a native layer which does not
+// implement them: on Android cordova answers "Invalid action", on iOS the call is never answered.
+
+let Module = require("module");
+let path = require("path");
+
+let wwwDir = path.join(__dirname, "..", "..", "www");
+let execPath = path.join(__dirname, "cordovaExec.js");
+let base64Path = path.join(__dirname, "cordovaBase64.js");
+
+let originalResolve = Module._resolveFilename;
+Module._resolveFilename = function (request, parent, isMain, options) {
+	if (request === "cordova/exec") return execPath;
+	if (request === "cordova/base64") return base64Path;
+	if (request.indexOf("./kfxMobilePlugin.") === 0) {
+		return path.join(wwwDir, request.slice("./kfxMobilePlugin.".length) + ".js");
+	}
+	return originalResolve.call(this, request, parent, isMain, options);
+};
+
+let state;
+
+// Resets the stand-in. options: {platform: "android" | "ios", latencyMs: Number | Function(action), sync: Boolean}.
+// latencyMs is the native time of each answer; sync answers within the exec call itself.
+function reset(options) {
+	options = options || {};
+	state = {
+		platform: options.platform || "android",
+		latencyMs: options.latencyMs || 0,
+		sync: !!options.sync,
+		handlers: {},
+		calls: [],
+		pending: 0,
+		busyUntil: 0,
+	};
+	on("kutGetNativeCapabilities", () => ({ actions: Object.keys(state.handlers) }));
+}
+
+// Registers the native implementation of an action. The handler gets (args, reply, call), with args as native decodes them and
+// call.messageBytes the size of the bridge message; its return value, when not undefined, is sent to the success callback. reply.success and reply.error may be called any number of times, like a native listener.
+function on(action, handler) {
+	state.handlers[action] = handler;
+}
+
+function off(action) {
+	delete state.handlers[action];
+}
+
+// cordova/exec sends the arguments and results as JSON, with ArrayBuffer values base64-encoded (massageArgsJsToNative)
+function massage(value) {
+	if (value instanceof ArrayBuffer || ArrayBuffer.isView(value)) {
+		let bytes = ArrayBuffer.isView(value)
+			? Buffer.from(value.buffer, value.byteOffset, value.byteLength)
+			: Buffer.from(value);
+		return { CDVType: "ArrayBuffer", data: bytes.toString("base64") };
+	}
+	return value;
+}
+
+function unmassage(value) {
+	if (value && value.CDVType === "ArrayBuffer") {
+		let bytes = Buffer.from(value.data, "base64");
+		return bytes.buffer.slice(bytes.byteOffset, bytes.byteOffset + bytes.byteLength);
+	}
+	return value;
+}
+
+// Native runs the kfxPlugin actions one at a time, so each call is answered latencyMs after the previous one was
+function deliver(action, callback, value) {
+	if (!callback) return;
+	if (value !== undefined) value = unmassage(JSON.parse(JSON.stringify(massage(value))));
+	if (state.sync) {
+		callback(value);
+		return;
+	}
+	let latency = typeof state.latencyMs === "function" ? state.latencyMs(action) : state.latencyMs;
+	let now = Date.now();
+	state.busyUntil = Math.max(now, state.busyUntil) + latency;
+	let delay = state.busyUntil - now;
+	state.pending++;
+	let run = () => {
+		state.pending--;
+		callback(value);
+	};
+	if (delay > 0) {
+		setTimeout(run, delay);
+	} else {
+		setImmediate(run);
+	}
+}
+
+function exec(success, error, service, action, args) {
+	let message = JSON.stringify((args || []).map(massage));
+	let call = { service: service, action: action, args: args, messageBytes: message.length };
+	state.calls.push(call);
+	let handler = state.handlers[action];
+	if (!handler) {
+		if (state.platform === "android") deliver(action, error, "Invalid action");
+		return;
+	}
+	let reply = {
+		success: (value) => deliver(action, success, value),
+		error: (value) => deliver(action, error, value),
+	};
+	let result;
+	try {
+		result = handler(JSON.parse(message).map(unmassage), reply, call);
+	} catch (e) {
+		reply.error({ ErrorMsg: "Exception", ErrorDesc: String(e && e.message) });
+		return;
+	}
+	if (result !== undefined) reply.success(result);
+}
+
+// Calls made so far, optionally only those to the given action
+function calls(action) {
+	return action ? state.calls.filter((call) => call.action === action) : state.calls;
+}
+
+// Resolves once every callback scheduled so far, including by pending microtasks, has run
+function settle() {
+	return new Promise((resolve) => {
+		let check = () => (state.pending > 0 ? setTimeout(check, 1) : setImmediate(resolve));
+		setImmediate(check);
+	});
+}
+
+// Returns a fresh copy of a www module and of every www module it requires, so module state does not leak between tests
+function load(name) {
+	Object.keys(require.cache).forEach((file) => {
+		if (file.indexOf(wwwDir) === 0) delete require.cache[file];
+	});
+	return require(path.join(wwwDir, name + ".js"));
+}
+
+reset();
+
+module.exports = {
+	reset: reset,
+	on: on,
+	off: off,
+	exec: exec,
+	calls: calls,
+	settle: settle,
+	load: load,
+};
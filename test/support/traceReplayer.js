@@ -0,0 +1,182 @@
+"use strict";
+
+// Replays a trace of ActionUtils.startRecording/stopRecording against the native stand-in.
+//
+// Every recorded call is made again through ActionUtils.exec at its recorded time, with an argument of its recorded size, so the
+// JavaScript layer does the same work as in the recorded session: instrumentation, recording, batching and the cordova/exec
+// serialization. The stand-in answers each call with the recorded callbacks, of the recorded kinds and result sizes. The first
+// callback comes after the latency of the chosen model and the following ones keep their recorded spacing, so listener cadence
+// is preserved.
+
+let { PerformanceObserver } = require("perf_hooks");
+let standIn = require("./nativeStandIn");
+
+// Calls of a trace, in call order, as {seq, t, service, action, argBytes, callbacks: [{type, dt, resultBytes, eventType}]}
+function calls(trace) {
+	let bySeq = new Map();
+	let list = [];
+	trace.events.forEach((event) => {
+		if (event.type === "call") {
+			let call = {
+				seq: event.seq,
+				t: event.t,
+				service: event.service,
+				action: event.action,
+				argBytes: event.argBytes,
+				callbacks: [],
+			};
+			bySeq.set(event.seq, call);
+			list.push(call);
+			return;
+		}
+		let call = bySeq.get(event.seq);
+		if (!call) return;
+		call.callbacks.push({
+			type: event.type,
+			dt: event.t - call.t,
+			resultBytes: event.resultBytes,
+			eventType: event.eventType,
+		});
+	});
+	return list;
+}
+
+// Deterministic generator, so sampled replays of the same trace and seed are identical
+function random(seed) {
+	let state = seed >>> 0 || 1;
+	return () => {
+		state ^= state << 13;
+		state ^= state >>> 17;
+		state ^= state << 5;
+		return (state >>> 0) / 4294967296;
+	};
+}
+
+// Returns the latency of the first callback of a call. latency: "recorded", "sampled" (drawn from the recorded latencies of
+// the same action) or a number of milliseconds.
+function latencyModel(list, latency, seed) {
+	if (typeof latency === "number") return () => latency;
+	if (latency === "sampled") {
+		let next = random(seed);
+		let samples = {};
+		list.forEach((call) => {
+			if (call.callbacks.length === 0) return;
+			(samples[call.action] = samples[call.action] || []).push(call.callbacks[0].dt);
+		});
+		return (call) => {
+			let values = samples[call.action];
+			return values ? values[Math.floor(next() * values.length)] : 0;
+		};
+	}
+	return (call) => (call.callbacks.length ? call.callbacks[0].dt : 0);
+}
+
+// A payload whose cordova/exec JSON is about the given size
+function payload(bytes) {
+	return "x".repeat(Math.max(0, bytes - 2));
+}
+
+function result(callback) {
+	if (!callback.eventType) return payload(callback.resultBytes);
+	return { eventType: callback.eventType, data: payload(callback.resultBytes - 40) };
+}
+
+function percentile(sorted, fraction) {
+	if (sorted.length === 0) return 0;
+	return sorted[Math.min(sorted.length - 1, Math.floor(fraction * sorted.length))];
+}
+
+// Replays a trace. options: {latency: "recorded" | "sampled" | Number, seed: Number, timeScale: Number}. timeScale multiplies
+// the recorded times and latencies. Resolves with {calls, callbacks, expectedCallbacks, errors, cpuMs, wallMs, peakHeapMB,
+// gcCount, latencyMs: {p50, p95, p99, max}}, where the latencies are from each call to its first callback, seen from JavaScript.
+function replay(trace, options) {
+	options = options || {};
+	let timeScale = options.timeScale === undefined ? 1 : options.timeScale;
+	let list = calls(trace);
+	let firstLatency = latencyModel(list, options.latency || "recorded", options.seed || 1);
+	let pendingByAction = {};
+
+	standIn.reset();
+	list.forEach((call) => {
+		if (pendingByAction[call.action]) return;
+		pendingByAction[call.action] = [];
+		standIn.on(call.action, (args, reply) => {
+			let recorded = pendingByAction[call.action].shift();
+			if (!recorded || recorded.callbacks.length === 0) return undefined;
+			let shift = firstLatency(recorded) - recorded.callbacks[0].dt;
+			recorded.callbacks.forEach((callback) => {
+				setTimeout(() => reply[callback.type](result(callback)), Math.max(0, (callback.dt + shift) * timeScale));
+			});
+			return undefined;
+		});
+	});
+	let ActionUtils = standIn.load("ActionUtils");
+
+	let gcCount = 0;
+	let observer = new PerformanceObserver((entries) => {
+		gcCount += entries.getEntries().length;
+	});
+	observer.observe({ entryTypes: ["gc"] });
+
+	let expectedCallbacks = list.reduce((total, call) => total + call.callbacks.length, 0);
+	let callbacks = 0;
+	let errors = 0;
+	let latencies = [];
+	let baselineHeap = process.memoryUsage().heapUsed;
+	let peakHeap = baselineHeap;
+	let cpuStart = process.cpuUsage();
+	let wallStart = process.hrtime.bigint();
+
+	return new Promise((resolve) => {
+		let finish = () => {
+			let cpu = process.cpuUsage(cpuStart);
+			observer.disconnect();
+			latencies.sort((a, b) => a - b);
+			resolve({
+				calls: list.length,
+				callbacks: callbacks,
+				expectedCallbacks: expectedCallbacks,
+				errors: errors,
+				cpuMs: (cpu.user + cpu.system) / 1000,
+				wallMs: Number(process.hrtime.bigint() - wallStart) / 1e6,
+				peakHeapMB: (peakHeap - baselineHeap) / 1048576,
+				gcCount: gcCount,
+				latencyMs: {
+					p50: percentile(latencies, 0.5),
+					p95: percentile(latencies, 0.95),
+					p99: percentile(latencies, 0.99),
+					max: latencies.length ? latencies[latencies.length - 1] : 0,
+				},
+			});
+		};
+		let outstanding = expectedCallbacks;
+		if (outstanding === 0) {
+			setImmediate(finish);
+		}
+		list.forEach((call) => {
+			setTimeout(() => {
+				let issued = process.hrtime.bigint();
+				let first = true;
+				let answered = (kind) => () => {
+					callbacks++;
+					if (kind === "error") errors++;
+					if (first) {
+						first = false;
+						latencies.push(Number(process.hrtime.bigint() - issued) / 1e6);
+					}
+					peakHeap = Math.max(peakHeap, process.memoryUsage().heapUsed);
+					if (--outstanding === 0) setImmediate(finish);
+				};
+				pendingByAction[call.action].push(call);
+				ActionUtils.exec(answered("success"), answered("error"), call.service, call.action, [
+					payload(call.argBytes),
+				]);
+			}, call.t * timeScale);
+		});
+	});
+}
+
+module.exports = {
+	calls: calls,
+	replay: replay,
+};
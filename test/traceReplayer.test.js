@@ -0,0 +1,38 @@
+"use strict";
+
+let test = require("node:test");
+let assert = require("node:assert");
+let traceReplayer = require("./support/traceReplayer");
+
+let trace = {
+	version: 1,
+	events: [
+		{ type: "call", seq: 1, t: 0, service: "kfxPlugin", action: "kuiAddLevelnessListener", argBytes: 2 },
+		{ type: "success", seq: 1, t: 1, resultBytes: 60, eventType: "eventRegistered" },
+		{ type: "call", seq: 2, t: 2, service: "kfxPlugin", action: "kloCreatePageObject", argBytes: 200 },
+		{ type: "success", seq: 1, t: 10, resultBytes: 100, eventType: "eventRaised" },
+		{ type: "error", seq: 2, t: 12, resultBytes: 40, eventType: null },
+		{ type: "success", seq: 1, t: 20, resultBytes: 100, eventType: "eventRaised" },
+	],
+};
+
+test("calls groups the recorded callbacks under their call", () => {
+	let calls = traceReplayer.calls(trace);
+	assert.deepStrictEqual(
+		calls.map((call) => [call.action, call.callbacks.map((callback) => callback.type + "@" + callback.dt)]),
+		[
+			["kuiAddLevelnessListener", ["success@1", "success@10", "success@20"]],
+			["kloCreatePageObject", ["error@10"]],
+		]
+	);
+});
+
+test("a replay delivers every recorded callback after the chosen latency", async () => {
+	let result = await traceReplayer.replay(trace, { latency: 30 });
+	assert.strictEqual(result.calls, 2);
+	assert.strictEqual(result.callbacks, 4);
+	assert.strictEqual(result.expectedCallbacks, 4);
+	assert.strictEqual(result.errors, 1);
+	assert.ok(result.latencyMs.p50 >= 29, "first callbacks arrive after the fixed latency");
+	assert.ok(result.wallMs >= 2 + 30 + 10, "the following callbacks keep their recorded spacing");
+});
@@ -1,337 +1,1069 @@
-//
-// ActionUtils.js
-//
-//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
-
-/**
- * These are the method names which are implemented in native side
- */
-
-module.exports = {
-	exec: require("cordova/exec"),
-	serviceName: "kfxPlugin",
-
-	// Image Capture Control Action Names
-	getImageCaptureControlID: "kuiGetImageCaptureControlID",
-	addCameraView: "kuiAddCameraView",
-	removeCameraView: "kuiRemoveCameraView",
-	forceTakePicture: "kuiForceTakePicture",
-	forceTakePictureFocusAgain: "kuiForceTakePictureFocusAgain",
-	setImageCaptureOptions: "kuiSetImageCaptureOptions",
-	getImageCaptureOptions: "kuiGetImageCaptureOptions",
-	addStabilityDelayListener: "kuiAddStablityDelayListener",
-	removeStabilityDelayListener: "kuiRemoveStablityDelayListener",
-	addLevelnessListener: "kuiAddLevelnessListener",
-	removeLevelnessListener: "kuiRemoveLevelnessListener",
-	addFocusListener: "kuiAddFocusListener",
-	removeFocusListener: "kuiRemoveFocusListener",
-	addImageCapturedListener: "kuiAddImageCapturedListener",
-	removeImageCapturedListener: "kuiRemoveImageCapturedListener",
-	addCameraInitializationListener: "kuiAddCameraInitializationListener",
-	removeCameraInitializationListener: "kuiRemoveCameraInitializationListener",
-	addCameraInitializationFailedListener: "kuiAddCameraInitializationFailedListener",
-	removeCameraInitializationFailedListener: "kuiRemoveCameraInitializationFailedListener",
-	getAllowableResolutions: "kuiGetAllowableResolutions",
-	setImageResolution: "kuiSetImageResolution",
-	addTorchLuminanceListener: "kuiAddTorchLuminanceListener",
-	removeTorchLuminanceListener: "kuiRemoveTorchLuminanceListener",
-	setFocusAreas: "kuiSetFocusAreas",
-	getMaxFocusAreas: "kuiGetMaxFocusAreas",
-	setCameraType: "kuiSetCameraType",
-
-	//Quick Extractor Agent
-	addQEAFieldsListener: "kuiQEAAddQuickExtractionFieldsListener",
-	removeQEAFieldsListener: "kuiQEARemoveQuickExtractionFieldsListener",
-	addQEAFaceListener: "kuiQEAAddQuickExtractionFaceListener",
-	removeQEAFaceListener: "kuiQEARemoveQuickExtractionFaceListener",
-	setCEAndQEASettings: "kuiQEASetCaptureExperienceAndQuickExtractionSettings",
-	qeaDestroy: "kuiQEADestroy",
-
-	//check capture control
-	bindCheckCaptureControl: "kuiCHEBindCaptureControl",
-	cheTakePicture: "kuiCHETakePicture",
-	cheTakePictureContinually: "kuiCHETakePictureContinually",
-	cheaddImageCapturedListener: "kuiCHEAddImageCapturedListener",
-	cheremoveImageCapturedListener: "kuiCHERemoveImageCapturedListener",
-	cheaddImageCapturedEventListener: "kuiCHEAddImageCapturedEventListener",
-	cheremoveImageCapturedEventListener: "kuiCHERemoveImageCapturedEventListener",
-	cheaddImageAboutToCaptureListener: "kuiCHEAddImageAboutToCaptureListener",
-	cheremoveImageAboutToCaptureListener: "kuiCHERemoveImageAboutToCaptureListener",
-	cheaddImageJustCapturedListener: "kuiCHEAddImageJustCapturedListener",
-	cheremoveImageJustCapturedListener: "kuiCHERemoveImageJustCapturedListener",
-	cheStopCapture: "kuiCHEStopCapture",
-	cheSetOptions: "kuiCHESetOptions",
-	cheGetOptions: "kuiCHEGetOptions",
-	cheDestroy: "kuiCHEDestroy",
-	bindCheckCaptureControlWithOptions: "kuiCHEBindCaptureControlWithOptions",
-
-	//Fixed Aspect Ratio Control
-
-	bindFixedAspectRatioCaptureControl: "kuiFCEBindCaptureControl",
-	fceTakePicture: "kuiFCETakePicture",
-	fceTakePictureContinually: "kuiFCETakePictureContinually",
-	fceaddImageCapturedListener: "kuiFCEAddImageCapturedListener",
-	fceremoveImageCapturedListener: "kuiFCERemoveImageCapturedListener",
-	fceaddImageCapturedEventListener: "kuiFCEAddImageCapturedEventListener",
-	fceremoveImageCapturedEventListener: "kuiFCERemoveImageCapturedEventListener",
-	fceaddImageAboutToCaptureListener: "kuiFCEAddImageAboutToCaptureListener",
-	fceremoveImageAboutToCaptureListener: "kuiFCERemoveImageAboutToCaptureListener",
-	fceaddImageJustCapturedListener: "kuiFCEAddImageJustCapturedListener",
-	fceremoveImageJustCapturedListener: "kuiFCERemoveImageJustCapturedListener",
-	fceStopCapture: "kuiFCEStopCapture",
-	fceSetOptions: "kuiFCESetOptions",
-	fceGetOptions: "kuiFCEGetOptions",
-	fceDestroy: "kuiFCEDestroy",
-	bindFixedAspectRatioCaptureControlWithOptions: "kuiFCEBindCaptureControlWithOptions",
-	fceGetDefaultGlareThreshold: "kuiFCEGetDefaultGlareThreshold",
-
-	//Document capture control
-	bindDocumentCaptureControl: "kuiDCBindCaptureControl",
-	dcTakePicture: "kuiDCTakePicture",
-	dcTakePictureContinually: "kuiDCTakePictureContinually",
-	dcaddImageCapturedListener: "kuiDCAddImageCapturedListener",
-	dcremoveImageCapturedListener: "kuiDCRemoveImageCapturedListener",
-	dcaddImageCapturedEventListener: "kuiDCAddImageCapturedEventListener",
-	dcremoveImageCapturedEventListener: "kuiDCRemoveImageCapturedEventListener",
-	dcaddImageAboutToCaptureListener: "kuiDCAddImageAboutToCaptureListener",
-	dcremoveImageAboutToCaptureListener: "kuiDCRemoveImageAboutToCaptureListener",
-	dcaddImageJustCapturedListener: "kuiDCAddImageJustCapturedListener",
-	dcremoveImageJustCapturedListener: "kuiDCRemoveImageJustCapturedListener",
-	dcStopCapture: "kuiDCStopCapture",
-	dcSetOptions: "kuiDCSetOptions",
-	dcGetOptions: "kuiDCGetOptions",
-	dcDestroy: "kuiDCDestroy",
-	bindDocumentCaptureControlWithOptions: "kuiDCBindCaptureControlWithOptions",
-	dcGetDefaultGlareThreshold: "kuiDCGetDefaultGlareThreshold",
-
-	//Passport capture control
-	bindPassportCaptureControl: "kuiPCBindCaptureControl",
-	pcTakePicture: "kuiPCTakePicture",
-	pcTakePictureContinually: "kuiPCTakePictureContinually",
-	pcaddImageCapturedListener: "kuiPCAddImageCapturedListener",
-	pcaddImageCapturedEventListener: "kuiPCAddImageCapturedEventListener",
-	pcremoveImageCapturedEventListener: "kuiPCRemoveImageCapturedEventListener",
-	pcremoveImageCapturedListener: "kuiPCRemoveImageCapturedListener",
-	pcaddImageAboutToCaptureListener: "kuiPCAddImageAboutToCaptureListener",
-	pcremoveImageAboutToCaptureListener: "kuiPCRemoveImageAboutToCaptureListener",
-	pcaddImageJustCapturedListener: "kuiPCAddImageJustCapturedListener",
-	pcremoveImageJustCapturedListener: "kuiPCRemoveImageJustCapturedListener",
-	pcStopCapture: "kuiPCStopCapture",
-	pcSetOptions: "kuiPCSetOptions",
-	pcGetOptions: "kuiPCGetOptions",
-	pcDestroy: "kuiPCDestroy",
-	bindPassportCaptureControlWithOptions: "kuiPCBindCaptureControlWithOptions",
-
-	//Selfie capture control
-	bindSelfieCaptureControl: "kuiSCBindCaptureControl",
-	scTakePicture: "kuiSCTakePicture",
-	scaddImageCapturedListener: "kuiSCAddImageCapturedListener",
-	scremoveImageCapturedListener: "kuiSCRemoveImageCapturedListener",
-	scStopCapture: "kuiSCStopCapture",
-	scSetOptions: "kuiSCSetOptions",
-	scGetOptions: "kuiSCGetOptions",
-	scDestroy: "kuiSCDestroy",
-	bindSelfieCaptureControlWithOptions: "kuiSCBindCaptureControlWithOptions",
-
-	// Barcode Capture Control Action Names
-	addBarcodeView: "kuiBCAddView",
-	removeBarcodeView: "kuiBCRemoveView",
-	setBarcodeOptions: "kuiBCSetOptions",
-	getBarcodeOptions: "kuiBCGetOptions",
-	readBarcode: "kuiBCReadBarcode",
-	kbcAddEventListener: "kuiBCAddEventListener",
-	kbcRemoveEventListener: "kuiBCRemoveEventListener",
-	kbcAddInitializationFailedListener: "kuiBCAddInitializationFailedListener",
-	kbcRemoveInitializationFailedListener: "kuiBCRemoveInitializationFailedListener",
-
-	// ImageEditReview Names
-	addImageReviewEditView: "kuiAddImageReviewView",
-	removeImageReviewEditView: "kuiRemoveImageReviewView",
-	setImageReviewEditOptions: "kuiSetImageReviewEditOptions",
-	getImageReviewEditOptions: "kuiGetImageReviewEditOptions",
-	getImage: "kuiGetImage",
-	setImage: "kuiSetImage",
-	clearImage: "kuiClearImage",
-	showHighlights: "kuiShowHighlights",
-	clearHighlights: "kuiClearHighlights",
-
-	//Image Array Action Names
-	getTotalImages: "kedGetTotalImages",
-	getImageIds: "kedGetImageIds",
-	getImagePropertiesWithId: "kedGetImageProperties",
-	getImageFromBase64: "kedGetImageFromBase64",
-	getImageFromFilepath: "kedGetImageFromFilePath",
-	getBase64ImageWithId: "kedGetImageToBase64",
-	removeImages: "kedRemoveImages",
-	setImagePropertiesWithId: "kedSetImageProperties",
-	getImageAsBlob: "kedGetImageAsBlob",
-	removeAllImages: "kedRemoveAllImages",
-	imageWriteToFile: "kedImageWriteToFile",
-	imageReadFromFile: "kedImageReadFromFile",
-	clearImageBitMap: "kedClearimageBitMap",
-	deleteFileFromDisk: "kedDeleteFileFromDisk",
-	getImageSize: "kedGetImageSize",
-
-	// License Action Names
-	setSDKLicense: "kutSetMobileSDKLicense",
-	getDaysRemaining: "kutGetDaysRemaining",
-	getSDKVersions: "kutGetSDKVersions",
-	setMobileSDKLicenseServer: "kutSetMobileSDKLicenceServer",
-	getRemainingVolumeCount: "kutGetRemainingVolumeCount",
-	addAcquireVolumeLicenseListener: "kutAddAcquireVolumeLicenseListener",
-	removeAcquireVolumeLicenseListener: "kutRemoveAcquireVolumeLicenseListener",
-	acquireVolumeLicenses: "kutAcquireVolumeLicenses",
-	updateCustomAcquireLicenseVolumeCount: "kutUpdateCustomAcquireLicenseVolumeCount",
-	addCustomAcquireVolumeLicenseListener: "kutAddCustomAcquireVolumeLicenseListener",
-	removeCustomAcquireVolumeLicenseListener: "kutRemoveCustomAcquireVolumeLicenseListener",
-
-	// Image Processor Action Names
-	processImage: "kenProcessImage",
-	cancelImageProcess: "kenCancelImageProcess",
-	setImageProcessorOptions: "kenImageProcessorSetOptions",
-	getImageProcessorOptions: "kenImageProcessorGetOptions",
-	doQuickAnalysis: "kenImageProcessorDoQuickAnalysis",
-	doQuickAnalysisWithSettings: "kenImageProcessorDoQuickAnalysisWithSettings",
-	specifyProcessedImageFilePath: "kenSpecifyProcessedImageFilePath",
-	getProcessedImageFilePath: "kenGetProcessedImageFilePath",
-	addImageOutEventListener: "kenImageProcessorAddImageOutEventListener",
-	addProcessProgressListener: "kenImageProcessorAddProcessProgressListener",
-	addAnalysisCompleteListener: "kenImageProcessorAddAnalysisCompleteListener",
-	addAnalysisProgressListener: "kenImageProcessorAddAnalysisProgressListener",
-	removeImageOutEventListener: "kenImageProcessorRemoveImageOutEventListener",
-	removeProcessProgressListener: "kenImageProcessorRemoveProcessProgressListener",
-	removeAnalysisCompleteListener: "kenImageProcessorRemoveAnalysisCompleteListener",
-	removeAnalysisProgressListener: "kenImageProcessorRemoveAnalysisProgressListener",
-
-	// Logging Action Names
-	kutEnableLogging: "kutEnableLogging",
-	kutDisableLogging: "kutDisableLogging",
-
-	// OnDeviceExtraction
-	kenODEAddOnDeviceExtractionListener: "kenODEAddOnDeviceExtractionListener",
-	kenODERemoveOnDeviceExtractionListener: "kenODERemoveOnDeviceExtractionListener",
-	kenODEAddFrontProcessedImageListener: "kenODEAddFrontProcessedImageListener",
-	kenODERemoveFrontProcessedImageListener: "kenODERemoveFrontProcessedImageListener",
-	kenODEAddBackProcessedImageListener: "kenODEAddBackProcessedImageListener",
-	kenODERemoveBackProcessedImageListener: "kenODERemoveBackProcessedImageListener",
-	kenODEExtractData: "kenODEExtractData",
-	kenODECancelExtraction: "kenODECancelExtraction",
-	kenODESetProvider: "kenODESetProvider",
-	kenODEGetProjectName: "kenODEGetProjectName",
-	// BundleCacheProvider
-	kenBundleCacheProvider: "kenBundleCacheProvider",
-	kenBundleCacheProviderGetProject: "kenBundleCacheProviderGetProject",
-	kenBundleCacheProviderGetVariant: "kenBundleCacheProviderGetVariant",
-	kenBundleCacheProviderCacheProject: "kenBundleCacheProviderCacheProject",
-	kenBundleCacheProviderCacheVariant: "kenBundleCacheProviderCacheVariant",
-	kenBundleCacheProviderGetLatestVersionForProject: "kenBundleCacheProviderGetLatestVersionForProject",
-	// ServerProjectProvider
-	kenServerProjectProviderGetHighestVersion: "kenServerProjectProviderGetHighestVersion",
-	kenServerProjectProviderGetProject: "kenServerProjectProviderGetProject",
-	kenServerProjectProviderGetVariant: "kenServerProjectProviderGetVariant",
-	kenServerProjectProviderLoadAllVariantsForProject: "kenServerProjectProviderLoadAllVariantsForProject",
-	kenServerProjectProviderCancelLoadAllVariants: "kenServerProjectProviderCancelLoadAllVariants",
-	kenServerProjectProviderSetRequestTimeOut: "kenServerProjectProviderSetRequestTimeOut",
-	kenServerProjectProvider: "kenServerProjectProvider",
-	kenServerProjectProviderUseCacheProvider: "kenServerProjectProviderUseCacheProvider",
-	// LocalProjectProvider
-	kenLocalProjectProviderGetHighestVersion: "kenLocalProjectProviderGetHighestVersion",
-	kenLocalProjectProviderGetProject: "kenLocalProjectProviderGetProject",
-	kenLocalProjectProviderGetVariant: "kenLocalProjectProviderGetVariant",
-	kenLocalProjectProvider: "kenLocalProjectProvider",
-	kenLocalProjectProviderUseCacheProvider: "kenLocalProjectProviderUseCacheProvider",
-
-	// Quick Extractor
-	kenQEAddQuickExtractionListener: "kenQEAddQuickExtractionListener",
-	kenQERemoveQuickExtractionListener: "kenQERemoveQuickExtractionListener",
-	kenQEQuickExtract: "kenQEQuickExtract",
-	kenQESetQuickExtractionSettings: "kenQESetQuickExtractionSettings",
-	kenQEDestroy: "kenQEDestroy",
-
-	//Capture Server Action Names
-	kloCaptureServerCreate: "kloCaptureServerCreate",
-	kloCaptureServerCleanCaptureServer: "kloCaptureServerCleanCaptureServer",
-	kloCaptureServerRegisterDevice: "kloCaptureServerRegisterDevice",
-	kloCaptureServerLogin: "kloCaptureServerLogin",
-	kloCaptureServerLoginAnonymously: "kloCaptureServerLoginAnonymously",
-	kloCaptureServerLogout: "kloCaptureServerLogout",
-	kloCaptureServerCancelSubmission: "kloCaptureServerCancelSubmission",
-	kloCaptureServerSubmitDocument: "kloCaptureServerSubmitDocument",
-	kloCaptureServerGetDocumentType: "kloCaptureServerGetDocumentType",
-	kloCaptureServerSetProperties: "kloCaptureServerSetProperties",
-	kloCaptureServerGetProperties: "kloCaptureServerGetProperties",
-	kloCaptureServerStartJobService: "kloCaptureServerStartJobService",
-	kloCaptureServerSendImageService: "kloCaptureServerSendImageService",
-	kloCaptureServeraddProgressListener: "kloCaptureServeraddProgressListener",
-	kloCaptureServerremoveProgressListener: "kloCaptureServerremoveProgressListener",
-
-	//Document Types Array Action Names
-	kloCreateDocumentTypeWithFieldTypes: "kloCreateDocumentTypeWithFieldTypes",
-	kloDeleteDocumentTypes: "kloDeleteDocumentTypes",
-	kloRemoveAllDocumentTypes: "kloRemoveAllDocumentTypes",
-	kloGetDocumentTypes: "kloGetDocumentTypes",
-	kloGetDocumentTypeProperties: "kloGetDocumentTypeProperties",
-
-	//Documents Array Action Names
-	kloAddPageToDocument: "kloAddPageToDocument",
-	kloRemovePageFromDocument: "kloRemovePageFromDocument",
-	kloCreateDocumentWithDocumentType: "kloCreateDocumentWithDocumentType",
-	kloCreateDocumentWithDocumentTypeAndId: "kloCreateDocumentWithDocumentTypeAndId",
-	kloDeleteDocuments: "kloDeleteDocuments",
-	kloUpdateFields: "kloUpdateFields",
-	kloRemoveAllDocuments: "kloRemoveAllDocuments",
-	kloGetDocumentIds: "kloGetDocumentIds",
-	kloGetDocumentProperties: "kloGetDocumentProperties",
-
-	//Pages Array Action Names
-	kloCreatePageObject: "kloCreatePageObject",
-	kloAddImageToPage: "kloAddImageToPage",
-	kloRemoveImageFromPage: "kloRemoveImageFromPage",
-	kloDeletePages: "kloDeletePages",
-	kloGetPageIds: "kloGetPageIds",
-	kloRemoveAllPages: "kloRemoveAllPages",
-	kloGetPageProperties: "kloGetPageProperties",
-	kloSetPageProperties: "kloSetPageProperties",
-
-	//ServerExtractor Action Names
-	kloServerExtractorCreate: "kloServerExtractorCreate",
-	kloServerExtractorLogin: "kloServerExtractorLogin",
-	kloServerExtractorExtractData: "kloServerExtractorExtractData",
-	kloServerExtractorCancelExtraction: "kloServerExtractorCancelExtraction",
-	kloServerExtractorSetOptions: "kloServerExtractorSetOptions",
-	kloServerExtractorGetOptions: "kloServerExtractorGetOptions",
-	kloServerExtractorClean: "kloServerExtractorClean",
-
-	//App Stats Action Names
-	kutAppStatsStartRecord: "kutAppStatsStartRecord",
-	kutAppStatsStopRecord: "kutAppStatsStopRecord",
-	kutAppStatsWriteToFile: "kutAppStatsWriteToFile",
-	kutAppStatsSetOptions: "kutAppStatsSetOptions",
-	kutAppStatsGetOptions: "kutAppStatsGetOptions",
-	kutAppStatsPurge: "kutAppStatsPurge",
-	kutAppStatsIsRecording: "kutAppStatsIsRecording",
-	kutAppStatsExport: "kutAppStatsExport",
-	kutAppStatsAddAppStatsExportListener: "kutAppStatsAddAppStatsExportListener",
-	kutAppStatsAddAppStatsWriteFileListener: "kutAppStatsAddAppStatsWriteFileListener",
-	kutAppStatsAddAppThresholdListener: "kutAppStatsAddAppThresholdListener",
-	kutAppStatsRemoveAppStatsExportListener: "kutAppStatsRemoveAppStatsExportListener",
-	kutAppStatsRemoveAppStatsWriteFileListener: "kutAppStatsRemoveAppStatsWriteFileListener",
-	kutAppStatsRemoveAppStatsThresholdListener: "kutAppStatsRemoveAppStatsThresholdListener",
-	kutAppStatsBeginSession: "kutAppStatsBeginSession",
-	kutAppStatsLogSessionEvent: "kutAppStatsLogSessionEvent",
-	kutAppStatsEndSession: "kutAppStatsEndSession",
-
-	//Glare Remover
-	kenGRRemoveGlare: "kenGRRemoveGlare",
-	kenGRGetGlareFraction: "kenGRGetGlareFraction",
-
-	//NFCTagReader
-	kenNFCReadTag: "kenNFCReadTag",
-	kenNFCVerifyDocumentSecurityObject: "kenNFCVerifyDocumentSecurityObject",
-	kenNFCAddReadTagListener: "kenNFCAddReadTagListener",
-	kenNFCAddDetectTagListener: "kenNFCAddDetectTagListener",
-	kenNFCAddDocumentSecurityObjectVerificationListener: "kenNFCAddDocumentSecurityObjectVerificationListener",
-	kenNFCRemoveReadTagListener: "kenNFCRemoveReadTagListener",
-	kenNFCRemoveDetectTagListener: "kenNFCRemoveDetectTagListener",
-	kenNFCRemoveDocumentSecurityObjectVerificationListener: "kenNFCRemoveDocumentSecurityObjectVerificationListener",
-};
+//
+// ActionUtils.js
+//
+//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var cordovaExec = require("cordova/exec");
+var BridgeMetrics = require("./BridgeMetrics");
+
+// Operations queued for the next kutExecBatch round-trip, or null when nothing is pending
+var pendingBatch = null;
+// Calls which cannot be batched, made while an explicit batch is open; they are sent right after it
+var heldCalls = [];
+// Nesting depth of beginBatch/commitBatch pairs
+var explicitBatchDepth = 0;
+// Set of the newer native actions reported by kutGetNativeCapabilities, or null until the native layer has answered
+var nativeActions = null;
+// Callbacks waiting for the kutGetNativeCapabilities answer, or null when no probe is in flight
+var capabilityWaiters = null;
+// True while a call gated on the probe is waiting; later calls are then held behind it so native sees them in call order
+var holdingCalls = false;
+// cordova-ios never answers an action which the plugin does not implement, so the probe gives up after this delay
+var CAPABILITY_PROBE_TIMEOUT_MS = 1000;
+// When true, batchable calls made in the same microtask are coalesced automatically
+var autoBatching = false;
+// When true, every call is timed into BridgeMetrics
+var instrumentation = false;
+// Trace of the session being recorded, or null when not recording
+var recording = null;
+
+/**
+ * Native action names which are safe to coalesce into a single kutExecBatch call. Only short, one-shot
+ * calls belong here; listener registrations keep their callback alive and must always go through cordova/exec directly.
+ */
+var batchableActions = {
+	kedGetTotalImages: true,
+	kedGetImageIds: true,
+	kedGetImageProperties: true,
+	kedSetImageProperties: true,
+	kedRemoveImages: true,
+	kloCreatePageObject: true,
+	kloAddImageToPage: true,
+	kloRemoveImageFromPage: true,
+	kloDeletePages: true,
+	kloGetPageIds: true,
+	kloGetPageProperties: true,
+	kloSetPageProperties: true,
+	kloAddPageToDocument: true,
+	kloRemovePageFromDocument: true,
+	kloDeleteDocuments: true,
+	kloUpdateFields: true,
+	kloGetDocumentIds: true,
+	kloGetDocumentProperties: true,
+};
+
+var scheduleMicrotask =
+	typeof Promise !== "undefined"
+		? function (task) {
+				Promise.resolve().then(task);
+		  }
+		: function (task) {
+				setTimeout(task, 0);
+		  };
+
+function isInvalidAction(error) {
+	if (error === "Invalid action") return true;
+	return error !== null && typeof error === "object" && error.ErrorMsg === "Invalid action";
+}
+
+/**
+ * Asks the native layer once which of the newer actions it implements, then calls back. A native layer without
+ * kutGetNativeCapabilities, such as the one shipped in lib/, implements none of them. When ordered is true the callback issues
+ * calls of the application, and every exec made after it is held until it has run (see exec).
+ */
+function whenCapabilitiesKnown(callback, ordered) {
+	if (nativeActions) {
+		callback();
+		return;
+	}
+	if (ordered) holdingCalls = true;
+	if (capabilityWaiters) {
+		capabilityWaiters.push(callback);
+		return;
+	}
+	capabilityWaiters = [callback];
+	var settle = function (actions) {
+		if (nativeActions) return;
+		nativeActions = {};
+		(actions || []).forEach(function (action) {
+			nativeActions[action] = true;
+		});
+		var waiters = capabilityWaiters;
+		capabilityWaiters = null;
+		holdingCalls = false;
+		waiters.forEach(function (waiter) {
+			waiter();
+		});
+	};
+	var timer = setTimeout(function () {
+		settle([]);
+	}, CAPABILITY_PROBE_TIMEOUT_MS);
+	cordovaExec(
+		function (result) {
+			clearTimeout(timer);
+			settle(result && result.actions);
+		},
+		function () {
+			clearTimeout(timer);
+			settle([]);
+		},
+		module.exports.serviceName,
+		module.exports.kutGetNativeCapabilities,
+		[]
+	);
+}
+
+/**
+ * Calls one of the newer native actions straight through cordova/exec, for the calls which must not be instrumented, recorded or
+ * batched themselves. unsupported is called instead when the native layer does not implement the action.
+ */
+function execDiagnostic(action, args, successCallback, errorCallback, unsupported) {
+	whenCapabilitiesKnown(function () {
+		if (!nativeActions[action]) {
+			unsupported();
+			return;
+		}
+		cordovaExec(
+			successCallback,
+			function (error) {
+				if (isInvalidAction(error)) {
+					delete nativeActions[action];
+					unsupported();
+				} else {
+					errorCallback(error);
+				}
+			},
+			module.exports.serviceName,
+			action,
+			args
+		);
+	});
+}
+
+/**
+ * Sends the given operations one cordova/exec call each, for native layers without kutExecBatch. The per-operation results
+ * are collected in the {status, message} form of kutExecBatch.
+ */
+function dispatchSeparately(operations, successCallback) {
+	var results = [];
+	var remaining = operations.length;
+	var settle = function (index, status, message) {
+		if (results[index]) return;
+		results[index] = { status: status, message: message };
+		if (--remaining === 0 && successCallback) successCallback(results);
+	};
+	if (remaining === 0 && successCallback) successCallback(results);
+	operations.forEach(function (operation, index) {
+		cordovaExec(
+			function (result) {
+				if (operation.success) operation.success(result);
+				settle(index, "OK", result);
+			},
+			function (error) {
+				if (operation.error) operation.error(error);
+				settle(index, "ERROR", error);
+			},
+			module.exports.serviceName,
+			operation.action,
+			operation.args
+		);
+	});
+}
+
+/**
+ * Sends the given operations to the native side in one kutExecBatch call and fans the per-operation results back out.
+ * The native side answers with an array holding one {status, message} entry per operation, in the same order.
+ * Until the native layer has reported kutExecBatch, and when it answers "Invalid action", the operations are sent one by one.
+ */
+function dispatchBatch(operations, successCallback, errorCallback) {
+	if (instrumentation) {
+		var dispatchTime = BridgeMetrics.now();
+		operations.forEach(function (operation) {
+			if (operation.timing) operation.timing.dispatch = dispatchTime;
+		});
+	}
+	if (!nativeActions || !nativeActions[module.exports.kutExecBatch]) {
+		if (!nativeActions) whenCapabilitiesKnown(function () {});
+		dispatchSeparately(operations, successCallback);
+		return;
+	}
+	if (operations.length === 1 && !successCallback && !errorCallback) {
+		var single = operations[0];
+		cordovaExec(single.success, single.error, module.exports.serviceName, single.action, single.args);
+		return;
+	}
+	var payload = operations.map(function (operation) {
+		return { action: operation.action, args: operation.args };
+	});
+	cordovaExec(
+		function (results) {
+			for (var i = 0; i < operations.length; i++) {
+				var result = results && results[i];
+				if (result && result.status === "OK") {
+					if (operations[i].success) operations[i].success(result.message);
+				} else {
+					if (operations[i].error) operations[i].error(result ? result.message : "KMC_EXEC_BATCH_NO_RESULT");
+				}
+			}
+			if (successCallback) successCallback(results);
+		},
+		function (error) {
+			if (isInvalidAction(error)) {
+				delete nativeActions[module.exports.kutExecBatch];
+				dispatchSeparately(operations, successCallback);
+				return;
+			}
+			for (var i = 0; i < operations.length; i++) {
+				if (operations[i].error) operations[i].error(error);
+			}
+			if (errorCallback) errorCallback(error);
+		},
+		module.exports.serviceName,
+		module.exports.kutExecBatch,
+		[payload]
+	);
+}
+
+function flushPendingBatch() {
+	if (pendingBatch) {
+		var operations = pendingBatch;
+		pendingBatch = null;
+		dispatchBatch(operations);
+	}
+	var held = heldCalls;
+	heldCalls = [];
+	held.forEach(function (operation) {
+		cordovaExec(operation.success, operation.error, operation.service, operation.action, operation.args);
+	});
+}
+
+// Flushes automatically batched calls at the end of the microtask, unless an explicit batch has been opened since
+function flushAutoBatch() {
+	if (explicitBatchDepth === 0) flushPendingBatch();
+}
+
+function enqueue(operation) {
+	if (!pendingBatch) {
+		pendingBatch = [];
+		if (explicitBatchDepth === 0) scheduleMicrotask(flushAutoBatch);
+	}
+	pendingBatch.push(operation);
+}
+
+/**
+ * Wraps the callbacks of a call so that the time until the first callback is recorded into BridgeMetrics.
+ * Listener callbacks may be invoked many times; only the first invocation ends the measured span.
+ */
+function instrumentCall(action, operation) {
+	var start = BridgeMetrics.now();
+	var timing = { dispatch: start };
+	var recorded = false;
+	var wrap = function (callback, failed) {
+		return function (result) {
+			if (!recorded) {
+				recorded = true;
+				BridgeMetrics.recordCall(action, start, timing.dispatch, BridgeMetrics.now(), failed);
+			}
+			if (callback) callback(result);
+		};
+	};
+	operation.success = wrap(operation.success, false);
+	operation.error = wrap(operation.error, true);
+	operation.timing = timing;
+	return operation;
+}
+
+/**
+ * Approximate size in bytes of a call argument or result as it crosses the bridge.
+ */
+function payloadSize(value) {
+	if (value === undefined || value === null) return 0;
+	if (typeof ArrayBuffer !== "undefined" && (value instanceof ArrayBuffer || ArrayBuffer.isView(value))) {
+		return value.byteLength;
+	}
+	if (Array.isArray(value)) {
+		return value.reduce(function (total, item) {
+			return total + payloadSize(item);
+		}, 0);
+	}
+	try {
+		var json = JSON.stringify(value);
+		return json ? json.length : 0;
+	} catch (e) {
+		return 0;
+	}
+}
+
+function recordEvent(event) {
+	if (recording.events.length >= recording.maxEvents) {
+		recording.droppedEvents++;
+		return;
+	}
+	event.t = BridgeMetrics.now() - recording.start;
+	recording.events.push(event);
+}
+
+/**
+ * Records a call and every invocation of its callbacks into the session trace. Only the sizes of the arguments and results
+ * are recorded, never their content.
+ */
+function recordCall(service, action, operation) {
+	var seq = ++recording.sequence;
+	var trace = recording;
+	recordEvent({ type: "call", seq: seq, service: service, action: action, argBytes: payloadSize(operation.args) });
+	var wrap = function (callback, kind) {
+		return function (result) {
+			if (recording === trace) {
+				recordEvent({
+					type: kind,
+					seq: seq,
+					resultBytes: payloadSize(result),
+					eventType: (result && result.eventType) || null,
+				});
+			}
+			if (callback) callback(result);
+		};
+	};
+	operation.success = wrap(operation.success, "success");
+	operation.error = wrap(operation.error, "error");
+}
+
+/**
+ * Sends a call made through exec: queued into the open batch when batchable, held until the batch is committed while an
+ * explicit batch is open, otherwise straight through cordova/exec.
+ */
+function dispatch(operation, service, action, args) {
+	var batching = explicitBatchDepth > 0 || autoBatching;
+	if (batching && service === module.exports.serviceName && batchableActions[action]) {
+		enqueue(operation);
+		return;
+	}
+	if (explicitBatchDepth > 0) {
+		operation.service = service;
+		heldCalls.push(operation);
+		return;
+	}
+	flushPendingBatch();
+	cordovaExec(operation.success, operation.error, service, action, args);
+}
+
+/**
+ * These are the method names which are implemented in native side
+ */
+
+module.exports = {
+	serviceName: "kfxPlugin",
+
+	/**
+	 * Entry point used by every plugin class to reach the native kfxPlugin. Has the same signature as cordova/exec.
+	 * While a batch is open (see beginBatch and setAutoBatching), calls to batchable actions are queued and sent together
+	 * in a single kutExecBatch round-trip. Other calls flush an automatic batch first so the native side sees them in call order;
+	 * inside beginBatch/commitBatch they are held and sent right after the batch, which always goes out as one unit.
+	 * While a call made through execExtended or isActionSupported waits for the kutGetNativeCapabilities answer, later calls are
+	 * held and sent after it, so the native side always sees the calls in the order they were made.
+	 */
+	exec: function (successCallback, errorCallback, service, action, args) {
+		var operation = { action: action, args: args || [], success: successCallback, error: errorCallback };
+		if (instrumentation) instrumentCall(action, operation);
+		if (recording) recordCall(service, action, operation);
+		if (holdingCalls) {
+			capabilityWaiters.push(function () {
+				dispatch(operation, service, action, args);
+			});
+			return;
+		}
+		dispatch(operation, service, action, args);
+	},
+
+	/**
+	 * Entry point for the actions which the native layer shipped in lib/ does not implement. The call only reaches native once
+	 * the native layer has listed the action in its kutGetNativeCapabilities answer; the first such call waits for that answer.
+	 * Otherwise, and when native answers "Invalid action", fallback is called instead when given, or errorCallback gets
+	 * {ErrorMsg: "Invalid action", ErrorDesc}.
+	 *
+	 * @param {Function} successCallback - Default Success call back function name
+	 * @param {Function} errorCallback - Default Error call back function name
+	 * @param {String} service - the service name, ActionUtils.serviceName
+	 * @param {String} action - native action name
+	 * @param {Array} args - the action arguments
+	 * @param {Function} [fallback] - called instead of the native action when the native layer does not implement it
+	 */
+	execExtended: function (successCallback, errorCallback, service, action, args, fallback) {
+		whenCapabilitiesKnown(function () {
+			var unsupported = function () {
+				if (fallback) {
+					fallback();
+				} else if (errorCallback) {
+					errorCallback({
+						ErrorMsg: "Invalid action",
+						ErrorDesc: action + " is not implemented by this version of the native kfxPlugin",
+					});
+				}
+			};
+			if (!nativeActions[action]) {
+				unsupported();
+				return;
+			}
+			module.exports.exec(
+				successCallback,
+				function (error) {
+					if (isInvalidAction(error)) {
+						delete nativeActions[action];
+						unsupported();
+					} else if (errorCallback) {
+						errorCallback(error);
+					}
+				},
+				service,
+				action,
+				args
+			);
+		}, true);
+	},
+
+	/**
+	 * Tells whether the native layer implements one of the newer actions, for APIs which change behaviour rather than fail.
+	 *
+	 * @param {String} action - native action name
+	 * @param {Function} callback - called with true or false; calls made after isActionSupported are held until it has run, so
+	 * calls made from the callback reach native in order
+	 */
+	isActionSupported: function (action, callback) {
+		whenCapabilitiesKnown(function () {
+			callback(!!nativeActions[action]);
+		}, true);
+	},
+
+	/**
+	 * Same as isActionSupported, but calls made meanwhile are not held. For checks made ahead of time, such as at bind time, whose
+	 * answer is only used by later calls.
+	 *
+	 * @param {String} action - native action name
+	 * @param {Function} callback - called with true or false
+	 */
+	probeActionSupport: function (action, callback) {
+		whenCapabilitiesKnown(function () {
+			callback(!!nativeActions[action]);
+		});
+	},
+
+	/**
+	 * Runs a list of operations on the native side in a single round-trip.
+	 *
+	 * @param {Function} successCallback - Called with the array of per-operation results, each one {status: "OK"|"ERROR", message}
+	 * @param {Function} errorCallback - Called when the batch as a whole could not be dispatched
+	 * @param {Array} operations - Ordered list of {action, args, success, error}. 'action' is a native action name such as
+	 * ActionUtils.kloAddImageToPage; 'success' and 'error' are optional per-operation callbacks.
+	 *
+	 * @example
+	 * ActionUtils.execBatch(function(results){
+	 *       alert(JSON.stringify(results));
+	 * },function(error){
+	 *       alert(JSON.stringify(error));
+	 * },[{action: ActionUtils.kloAddImageToPage, args: [{pageID: "pageID", imageID: "imageID"}]},
+	 *    {action: ActionUtils.kloAddPageToDocument, args: [{documentID: "documentID", pageID: "pageID"}]}]);
+	 */
+	execBatch: function (successCallback, errorCallback, operations) {
+		flushPendingBatch();
+		dispatchBatch(
+			operations.map(function (operation) {
+				return {
+					action: operation.action,
+					args: operation.args || [],
+					success: operation.success,
+					error: operation.error,
+				};
+			}),
+			successCallback || function () {},
+			errorCallback
+		);
+	},
+
+	/**
+	 * Opens an explicit batch. Every batchable call made until the matching commitBatch is queued instead of sent, and so are the
+	 * calls which cannot be batched, which are sent right after the batch. Calls may be nested; only the outermost commitBatch
+	 * sends the queue.
+	 */
+	beginBatch: function () {
+		explicitBatchDepth++;
+	},
+
+	/**
+	 * Closes a batch opened with beginBatch and sends the queued calls in one kutExecBatch round-trip.
+	 */
+	commitBatch: function () {
+		if (explicitBatchDepth === 0) return;
+		explicitBatchDepth--;
+		if (explicitBatchDepth === 0) flushPendingBatch();
+	},
+
+	/**
+	 * Enables or disables automatic batching. When enabled, batchable calls issued within the same microtask are
+	 * coalesced into one kutExecBatch round-trip. Disabled by default.
+	 *
+	 * @param {Boolean} enabled
+	 */
+	setAutoBatching: function (enabled) {
+		autoBatching = !!enabled;
+		if (!autoBatching && explicitBatchDepth === 0) flushPendingBatch();
+	},
+
+	/**
+	 * Enables or disables bridge instrumentation. When enabled, the time from every JavaScript call to its first callback is
+	 * recorded per action name, and native is asked to record its own phases (argument decoding, queueing on the plugin thread,
+	 * the native work and result encoding). Disabled by default. On the JavaScript side an instrumented call costs two timestamps,
+	 * two callback wrappers and a histogram and ring buffer update: bench/bridgeInstrumentation.js measures 0.1 to 1 microsecond
+	 * per call in Node, next to 7 to 10 microseconds for the uninstrumented call through the native stand-in.
+	 *
+	 * The JavaScript side is switched once native has answered. A native layer without kutSetBridgeInstrumentation, such as the
+	 * one shipped in lib/, only gets the JavaScript measurements; when native fails, nothing is switched and errorCallback is called.
+	 *
+	 * @param {Function} successCallback - Default Success call back function name
+	 * @param {Function} errorCallback - Default Error call back function name
+	 * @param {Object} parameters - {enabled: Boolean, spanCapacity: Number}. spanCapacity is the number of recent calls kept for trace export (default 4096).
+	 *
+	 * @example
+	 * ActionUtils.setInstrumentation(successCallback, errorCallback, {enabled: true});
+	 */
+	setInstrumentation: function (successCallback, errorCallback, parameters) {
+		var enabled = !!parameters.enabled;
+		var apply = function (result) {
+			if (enabled) BridgeMetrics.reset(parameters.spanCapacity);
+			instrumentation = enabled;
+			if (successCallback) successCallback(result);
+		};
+		execDiagnostic(
+			module.exports.kutSetBridgeInstrumentation,
+			[{ enabled: enabled }],
+			apply,
+			function (error) {
+				if (errorCallback) errorCallback(error);
+			},
+			function () {
+				apply("KMC_SUCCESS");
+			}
+		);
+	},
+
+	/**
+	 * Gets the bridge latency metrics recorded since instrumentation was enabled.
+	 *
+	 * @param {Function} successCallback - called with {js, native}. 'js' holds the round-trip latency histogram summary per action
+	 * ({count, meanMs, p50Ms, p90Ms, p99Ms, maxMs}), 'native' holds the per-phase summaries reported by kutGetBridgeMetrics. 'native'
+	 * is left out when the native layer does not implement kutGetBridgeMetrics, and replaced by 'nativeError' when it fails.
+	 * @param {Function} errorCallback - Default Error call back function name
+	 *
+	 * @example
+	 * ActionUtils.getBridgeMetrics(function(metrics){
+	 *       alert(JSON.stringify(metrics.js.kloUpdateFields));
+	 * },errorCallback);
+	 */
+	getBridgeMetrics: function (successCallback, errorCallback) {
+		var metrics = { js: BridgeMetrics.getSummary() };
+		var report = function () {
+			if (successCallback) successCallback(metrics);
+		};
+		execDiagnostic(
+			module.exports.kutGetBridgeMetrics,
+			[{ includeSpans: false }],
+			function (result) {
+				metrics.native = result.actions;
+				report();
+			},
+			function (error) {
+				metrics.nativeError = error;
+				report();
+			},
+			report
+		);
+	},
+
+	/**
+	 * Exports the recorded calls as a Chrome trace_event document, with the JavaScript round-trips and the native phases on
+	 * separate threads. Save the result with JSON.stringify and open it in chrome://tracing or Perfetto. The document only holds
+	 * the JavaScript spans when the native layer does not implement kutGetBridgeMetrics or fails to report its spans.
+	 *
+	 * @param {Function} successCallback - called with the trace document
+	 * @param {Function} errorCallback - Default Error call back function name
+	 *
+	 * @example
+	 * ActionUtils.exportChromeTrace(function(trace){
+	 *       saveFile("capture-flow.json", JSON.stringify(trace));
+	 * },errorCallback);
+	 */
+	exportChromeTrace: function (successCallback, errorCallback) {
+		// Native reports its span start times relative to the moment it receives this call, which corresponds to clockMs here
+		var clockMs = BridgeMetrics.now() - BridgeMetrics.getTraceOrigin();
+		var report = function (nativeSpans) {
+			if (successCallback) successCallback(BridgeMetrics.toChromeTrace(nativeSpans));
+		};
+		execDiagnostic(
+			module.exports.kutGetBridgeMetrics,
+			[{ includeSpans: true, clockMs: clockMs }],
+			function (result) {
+				report(result.spans);
+			},
+			function () {
+				report();
+			},
+			report
+		);
+	},
+
+	/**
+	 * Starts recording the bridge traffic of the session. Every call made through exec is recorded with its action name, the size
+	 * of its arguments and its time, and every callback invocation with the size of its result and its time, so both the latency
+	 * and the cadence of listener events are kept. Argument and result contents are not recorded.
+	 *
+	 * The trace returned by stopRecording can be replayed outside the WebView, by loading the www modules in Node with a
+	 * cordova/exec stand-in which answers each action after the recorded latency (or one sampled from the recorded distribution).
+	 *
+	 * @param {Object} [parameters] - {maxEvents: Number}, the number of events kept (default 100000). Later events are counted as dropped.
+	 *
+	 * @example
+	 * ActionUtils.startRecording({maxEvents: 50000});
+	 */
+	startRecording: function (parameters) {
+		recording = {
+			start: BridgeMetrics.now(),
+			startedAt: new Date().toISOString(),
+			maxEvents: (parameters && parameters.maxEvents) || 100000,
+			sequence: 0,
+			droppedEvents: 0,
+			events: [],
+		};
+	},
+
+	/**
+	 * Stops recording and returns the trace.
+	 *
+	 * @return {version, startedAt, durationMs, droppedEvents, events}, or null when no recording was in progress. Each event is
+	 * {type: "call", seq, t, service, action, argBytes} or {type: "success"|"error", seq, t, resultBytes, eventType}, where seq links
+	 * callbacks to their call and t is in milliseconds since startRecording. Save it with JSON.stringify.
+	 *
+	 * @example
+	 * var trace = ActionUtils.stopRecording();
+	 * saveFile("document-capture.trace.json", JSON.stringify(trace));
+	 */
+	stopRecording: function () {
+		if (!recording) return null;
+		var trace = {
+			version: 1,
+			startedAt: recording.startedAt,
+			durationMs: BridgeMetrics.now() - recording.start,
+			droppedEvents: recording.droppedEvents,
+			events: recording.events,
+		};
+		recording = null;
+		return trace;
+	},
+
+	/**
+	 * Marks a native action as batchable or not.
+	 *
+	 * @param {String} action - native action name, e.g. ActionUtils.kloUpdateFields
+	 * @param {Boolean} batchable
+	 */
+	setBatchable: function (action, batchable) {
+		if (batchable) {
+			batchableActions[action] = true;
+		} else {
+			delete batchableActions[action];
+		}
+	},
+
+	// Bridge Action Names
+	kutGetNativeCapabilities: "kutGetNativeCapabilities",
+	kutExecBatch: "kutExecBatch",
+	kutSetBridgeInstrumentation: "kutSetBridgeInstrumentation",
+	kutGetBridgeMetrics: "kutGetBridgeMetrics",
+	kutOpenEventChannel: "kutOpenEventChannel",
+	kutCloseEventChannel: "kutCloseEventChannel",
+	kutSubscribeEvent: "kutSubscribeEvent",
+	kutUnsubscribeEvent: "kutUnsubscribeEvent",
+	kutReleaseHandles: "kutReleaseHandles",
+	kutGetLiveObjectReport: "kutGetLiveObjectReport",
+	kutSetExtractionCacheOptions: "kutSetExtractionCacheOptions",
+	kutGetExtractionCacheStats: "kutGetExtractionCacheStats",
+	kutClearExtractionCache: "kutClearExtractionCache",
+	kutGetStartupReport: "kutGetStartupReport",
+
+	// Image Capture Control Action Names
+	getImageCaptureControlID: "kuiGetImageCaptureControlID",
+	addCameraView: "kuiAddCameraView",
+	removeCameraView: "kuiRemoveCameraView",
+	forceTakePicture: "kuiForceTakePicture",
+	forceTakePictureFocusAgain: "kuiForceTakePictureFocusAgain",
+	setImageCaptureOptions: "kuiSetImageCaptureOptions",
+	getImageCaptureOptions: "kuiGetImageCaptureOptions",
+	addStabilityDelayListener: "kuiAddStablityDelayListener",
+	removeStabilityDelayListener: "kuiRemoveStablityDelayListener",
+	addLevelnessListener: "kuiAddLevelnessListener",
+	removeLevelnessListener: "kuiRemoveLevelnessListener",
+	addFocusListener: "kuiAddFocusListener",
+	removeFocusListener: "kuiRemoveFocusListener",
+	addImageCapturedListener: "kuiAddImageCapturedListener",
+	removeImageCapturedListener: "kuiRemoveImageCapturedListener",
+	addCameraInitializationListener: "kuiAddCameraInitializationListener",
+	removeCameraInitializationListener: "kuiRemoveCameraInitializationListener",
+	addCameraInitializationFailedListener: "kuiAddCameraInitializationFailedListener",
+	removeCameraInitializationFailedListener: "kuiRemoveCameraInitializationFailedListener",
+	getAllowableResolutions: "kuiGetAllowableResolutions",
+	setImageResolution: "kuiSetImageResolution",
+	addTorchLuminanceListener: "kuiAddTorchLuminanceListener",
+	removeTorchLuminanceListener: "kuiRemoveTorchLuminanceListener",
+	setFocusAreas: "kuiSetFocusAreas",
+	getMaxFocusAreas: "kuiGetMaxFocusAreas",
+	setCameraType: "kuiSetCameraType",
+
+	//Quick Extractor Agent
+	addQEAFieldsListener: "kuiQEAAddQuickExtractionFieldsListener",
+	removeQEAFieldsListener: "kuiQEARemoveQuickExtractionFieldsListener",
+	addQEAFaceListener: "kuiQEAAddQuickExtractionFaceListener",
+	removeQEAFaceListener: "kuiQEARemoveQuickExtractionFaceListener",
+	setCEAndQEASettings: "kuiQEASetCaptureExperienceAndQuickExtractionSettings",
+	qeaDestroy: "kuiQEADestroy",
+
+	//check capture control
+	bindCheckCaptureControl: "kuiCHEBindCaptureControl",
+	cheTakePicture: "kuiCHETakePicture",
+	cheTakePictureContinually: "kuiCHETakePictureContinually",
+	cheGetFrameAnalysisStats: "kuiCHEGetFrameAnalysisStats",
+	cheaddImageCapturedListener: "kuiCHEAddImageCapturedListener",
+	cheremoveImageCapturedListener: "kuiCHERemoveImageCapturedListener",
+	cheaddImageCapturedEventListener: "kuiCHEAddImageCapturedEventListener",
+	cheremoveImageCapturedEventListener: "kuiCHERemoveImageCapturedEventListener",
+	cheaddImageAboutToCaptureListener: "kuiCHEAddImageAboutToCaptureListener",
+	cheremoveImageAboutToCaptureListener: "kuiCHERemoveImageAboutToCaptureListener",
+	cheaddImageJustCapturedListener: "kuiCHEAddImageJustCapturedListener",
+	cheremoveImageJustCapturedListener: "kuiCHERemoveImageJustCapturedListener",
+	cheStopCapture: "kuiCHEStopCapture",
+	cheSetOptions: "kuiCHESetOptions",
+	cheSetOptionsDelta: "kuiCHESetOptionsDelta",
+	cheGetOptions: "kuiCHEGetOptions",
+	cheDestroy: "kuiCHEDestroy",
+	bindCheckCaptureControlWithOptions: "kuiCHEBindCaptureControlWithOptions",
+
+	//Fixed Aspect Ratio Control
+
+	bindFixedAspectRatioCaptureControl: "kuiFCEBindCaptureControl",
+	fceTakePicture: "kuiFCETakePicture",
+	fceTakePictureContinually: "kuiFCETakePictureContinually",
+	fceGetFrameAnalysisStats: "kuiFCEGetFrameAnalysisStats",
+	fceaddImageCapturedListener: "kuiFCEAddImageCapturedListener",
+	fceremoveImageCapturedListener: "kuiFCERemoveImageCapturedListener",
+	fceaddImageCapturedEventListener: "kuiFCEAddImageCapturedEventListener",
+	fceremoveImageCapturedEventListener: "kuiFCERemoveImageCapturedEventListener",
+	fceaddImageAboutToCaptureListener: "kuiFCEAddImageAboutToCaptureListener",
+	fceremoveImageAboutToCaptureListener: "kuiFCERemoveImageAboutToCaptureListener",
+	fceaddImageJustCapturedListener: "kuiFCEAddImageJustCapturedListener",
+	fceremoveImageJustCapturedListener: "kuiFCERemoveImageJustCapturedListener",
+	fceStopCapture: "kuiFCEStopCapture",
+	fceSetOptions: "kuiFCESetOptions",
+	fceSetOptionsDelta: "kuiFCESetOptionsDelta",
+	fceGetOptions: "kuiFCEGetOptions",
+	fceDestroy: "kuiFCEDestroy",
+	bindFixedAspectRatioCaptureControlWithOptions: "kuiFCEBindCaptureControlWithOptions",
+	fceGetDefaultGlareThreshold: "kuiFCEGetDefaultGlareThreshold",
+
+	//Document capture control
+	bindDocumentCaptureControl: "kuiDCBindCaptureControl",
+	dcTakePicture: "kuiDCTakePicture",
+	dcTakePictureContinually: "kuiDCTakePictureContinually",
+	dcGetFrameAnalysisStats: "kuiDCGetFrameAnalysisStats",
+	dcaddImageCapturedListener: "kuiDCAddImageCapturedListener",
+	dcremoveImageCapturedListener: "kuiDCRemoveImageCapturedListener",
+	dcaddImageCapturedEventListener: "kuiDCAddImageCapturedEventListener",
+	dcremoveImageCapturedEventListener: "kuiDCRemoveImageCapturedEventListener",
+	dcaddImageAboutToCaptureListener: "kuiDCAddImageAboutToCaptureListener",
+	dcremoveImageAboutToCaptureListener: "kuiDCRemoveImageAboutToCaptureListener",
+	dcaddImageJustCapturedListener: "kuiDCAddImageJustCapturedListener",
+	dcremoveImageJustCapturedListener: "kuiDCRemoveImageJustCapturedListener",
+	dcStopCapture: "kuiDCStopCapture",
+	dcSetOptions: "kuiDCSetOptions",
+	dcSetOptionsDelta: "kuiDCSetOptionsDelta",
+	dcGetOptions: "kuiDCGetOptions",
+	dcDestroy: "kuiDCDestroy",
+	bindDocumentCaptureControlWithOptions: "kuiDCBindCaptureControlWithOptions",
+	dcGetDefaultGlareThreshold: "kuiDCGetDefaultGlareThreshold",
+
+	//Passport capture control
+	bindPassportCaptureControl: "kuiPCBindCaptureControl",
+	pcTakePicture: "kuiPCTakePicture",
+	pcTakePictureContinually: "kuiPCTakePictureContinually",
+	pcGetFrameAnalysisStats: "kuiPCGetFrameAnalysisStats",
+	pcaddImageCapturedListener: "kuiPCAddImageCapturedListener",
+	pcaddImageCapturedEventListener: "kuiPCAddImageCapturedEventListener",
+	pcremoveImageCapturedEventListener: "kuiPCRemoveImageCapturedEventListener",
+	pcremoveImageCapturedListener: "kuiPCRemoveImageCapturedListener",
+	pcaddImageAboutToCaptureListener: "kuiPCAddImageAboutToCaptureListener",
+	pcremoveImageAboutToCaptureListener: "kuiPCRemoveImageAboutToCaptureListener",
+	pcaddImageJustCapturedListener: "kuiPCAddImageJustCapturedListener",
+	pcremoveImageJustCapturedListener: "kuiPCRemoveImageJustCapturedListener",
+	pcStopCapture: "kuiPCStopCapture",
+	pcSetOptions: "kuiPCSetOptions",
+	pcSetOptionsDelta: "kuiPCSetOptionsDelta",
+	pcGetOptions: "kuiPCGetOptions",
+	pcDestroy: "kuiPCDestroy",
+	bindPassportCaptureControlWithOptions: "kuiPCBindCaptureControlWithOptions",
+
+	//Selfie capture control
+	bindSelfieCaptureControl: "kuiSCBindCaptureControl",
+	scTakePicture: "kuiSCTakePicture",
+	scaddImageCapturedListener: "kuiSCAddImageCapturedListener",
+	scremoveImageCapturedListener: "kuiSCRemoveImageCapturedListener",
+	scStopCapture: "kuiSCStopCapture",
+	scSetOptions: "kuiSCSetOptions",
+	scSetOptionsDelta: "kuiSCSetOptionsDelta",
+	scGetOptions: "kuiSCGetOptions",
+	scDestroy: "kuiSCDestroy",
+	bindSelfieCaptureControlWithOptions: "kuiSCBindCaptureControlWithOptions",
+
+	// Barcode Capture Control Action Names
+	addBarcodeView: "kuiBCAddView",
+	removeBarcodeView: "kuiBCRemoveView",
+	setBarcodeOptions: "kuiBCSetOptions",
+	getBarcodeOptions: "kuiBCGetOptions",
+	readBarcode: "kuiBCReadBarcode",
+	kbcAddEventListener: "kuiBCAddEventListener",
+	kbcRemoveEventListener: "kuiBCRemoveEventListener",
+	kbcAddInitializationFailedListener: "kuiBCAddInitializationFailedListener",
+	kbcRemoveInitializationFailedListener: "kuiBCRemoveInitializationFailedListener",
+	kbcGetDecodeStats: "kuiBCGetDecodeStats",
+
+	// ImageEditReview Names
+	addImageReviewEditView: "kuiAddImageReviewView",
+	removeImageReviewEditView: "kuiRemoveImageReviewView",
+	setImageReviewEditOptions: "kuiSetImageReviewEditOptions",
+	getImageReviewEditOptions: "kuiGetImageReviewEditOptions",
+	getImage: "kuiGetImage",
+	setImage: "kuiSetImage",
+	clearImage: "kuiClearImage",
+	showHighlights: "kuiShowHighlights",
+	clearHighlights: "kuiClearHighlights",
+	updateHighlights: "kuiUpdateHighlights",
+	setImageReviewRenderingOptions: "kuiSetImageReviewRenderingOptions",
+	getImageReviewRenderingStats: "kuiGetImageReviewRenderingStats",
+
+	//Image Array Action Names
+	getTotalImages: "kedGetTotalImages",
+	getImageIds: "kedGetImageIds",
+	getImagePropertiesWithId: "kedGetImageProperties",
+	getImageFromBase64: "kedGetImageFromBase64",
+	getImageFromFilepath: "kedGetImageFromFilePath",
+	getBase64ImageWithId: "kedGetImageToBase64",
+	removeImages: "kedRemoveImages",
+	setImagePropertiesWithId: "kedSetImageProperties",
+	getImageAsBlob: "kedGetImageAsBlob",
+	getImageFromArrayBuffer: "kedGetImageFromArrayBuffer",
+	appendImageChunk: "kedAppendImageChunk",
+	getImageChunk: "kedGetImageChunk",
+	removeAllImages: "kedRemoveAllImages",
+	imageWriteToFile: "kedImageWriteToFile",
+	imageWriteToFiles: "kedImageWriteToFiles",
+	imageReadFromFile: "kedImageReadFromFile",
+	clearImageBitMap: "kedClearimageBitMap",
+	deleteFileFromDisk: "kedDeleteFileFromDisk",
+	getImageSize: "kedGetImageSize",
+	setImageCacheOptions: "kedSetImageCacheOptions",
+	getImageCacheStats: "kedGetImageCacheStats",
+	pinImage: "kedPinImage",
+	unpinImage: "kedUnpinImage",
+
+	// License Action Names
+	setSDKLicense: "kutSetMobileSDKLicense",
+	getDaysRemaining: "kutGetDaysRemaining",
+	getSDKVersions: "kutGetSDKVersions",
+	setMobileSDKLicenseServer: "kutSetMobileSDKLicenceServer",
+	getRemainingVolumeCount: "kutGetRemainingVolumeCount",
+	addAcquireVolumeLicenseListener: "kutAddAcquireVolumeLicenseListener",
+	removeAcquireVolumeLicenseListener: "kutRemoveAcquireVolumeLicenseListener",
+	acquireVolumeLicenses: "kutAcquireVolumeLicenses",
+	updateCustomAcquireLicenseVolumeCount: "kutUpdateCustomAcquireLicenseVolumeCount",
+	addCustomAcquireVolumeLicenseListener: "kutAddCustomAcquireVolumeLicenseListener",
+	removeCustomAcquireVolumeLicenseListener: "kutRemoveCustomAcquireVolumeLicenseListener",
+
+	// Image Processor Action Names
+	processImage: "kenProcessImage",
+	cancelImageProcess: "kenCancelImageProcess",
+	setImageProcessorOptions: "kenImageProcessorSetOptions",
+	getImageProcessorOptions: "kenImageProcessorGetOptions",
+	doQuickAnalysis: "kenImageProcessorDoQuickAnalysis",
+	doQuickAnalysisWithSettings: "kenImageProcessorDoQuickAnalysisWithSettings",
+	specifyProcessedImageFilePath: "kenSpecifyProcessedImageFilePath",
+	getProcessedImageFilePath: "kenGetProcessedImageFilePath",
+	addImageOutEventListener: "kenImageProcessorAddImageOutEventListener",
+	addProcessProgressListener: "kenImageProcessorAddProcessProgressListener",
+	addAnalysisCompleteListener: "kenImageProcessorAddAnalysisCompleteListener",
+	addAnalysisProgressListener: "kenImageProcessorAddAnalysisProgressListener",
+	removeImageOutEventListener: "kenImageProcessorRemoveImageOutEventListener",
+	removeProcessProgressListener: "kenImageProcessorRemoveProcessProgressListener",
+	removeAnalysisCompleteListener: "kenImageProcessorRemoveAnalysisCompleteListener",
+	removeAnalysisProgressListener: "kenImageProcessorRemoveAnalysisProgressListener",
+
+	// Image Processing Queue Action Names
+	processImageBatch: "kenProcessImageBatch",
+	setProcessImageBatchOptions: "kenSetProcessImageBatchOptions",
+	cancelProcessImageBatch: "kenCancelProcessImageBatch",
+
+	// Logging Action Names
+	kutEnableLogging: "kutEnableLogging",
+	kutDisableLogging: "kutDisableLogging",
+	kutSetLoggingOptions: "kutSetLoggingOptions",
+	kutWriteLogRecords: "kutWriteLogRecords",
+	kutFlushLogs: "kutFlushLogs",
+	kutGetLoggingStats: "kutGetLoggingStats",
+
+	// OnDeviceExtraction
+	kenODEAddOnDeviceExtractionListener: "kenODEAddOnDeviceExtractionListener",
+	kenODERemoveOnDeviceExtractionListener: "kenODERemoveOnDeviceExtractionListener",
+	kenODEAddFrontProcessedImageListener: "kenODEAddFrontProcessedImageListener",
+	kenODERemoveFrontProcessedImageListener: "kenODERemoveFrontProcessedImageListener",
+	kenODEAddBackProcessedImageListener: "kenODEAddBackProcessedImageListener",
+	kenODERemoveBackProcessedImageListener: "kenODERemoveBackProcessedImageListener",
+	kenODEExtractData: "kenODEExtractData",
+	kenODECancelExtraction: "kenODECancelExtraction",
+	kenODESetProvider: "kenODESetProvider",
+	kenODEGetProjectName: "kenODEGetProjectName",
+	kenODEWarmUp: "kenODEWarmUp",
+	kenODEEvictModels: "kenODEEvictModels",
+	kenODEGetTimingReport: "kenODEGetTimingReport",
+	// BundleCacheProvider
+	kenBundleCacheProvider: "kenBundleCacheProvider",
+	kenBundleCacheProviderGetProject: "kenBundleCacheProviderGetProject",
+	kenBundleCacheProviderGetVariant: "kenBundleCacheProviderGetVariant",
+	kenBundleCacheProviderCacheProject: "kenBundleCacheProviderCacheProject",
+	kenBundleCacheProviderCacheVariant: "kenBundleCacheProviderCacheVariant",
+	kenBundleCacheProviderGetLatestVersionForProject: "kenBundleCacheProviderGetLatestVersionForProject",
+	kenBundleCacheProviderGetIndexInfo: "kenBundleCacheProviderGetIndexInfo",
+	kenBundleCacheProviderRebuildIndex: "kenBundleCacheProviderRebuildIndex",
+	// ServerProjectProvider
+	kenServerProjectProviderGetHighestVersion: "kenServerProjectProviderGetHighestVersion",
+	kenServerProjectProviderGetProject: "kenServerProjectProviderGetProject",
+	kenServerProjectProviderGetVariant: "kenServerProjectProviderGetVariant",
+	kenServerProjectProviderLoadAllVariantsForProject: "kenServerProjectProviderLoadAllVariantsForProject",
+	kenServerProjectProviderCancelLoadAllVariants: "kenServerProjectProviderCancelLoadAllVariants",
+	kenServerProjectProviderSetRequestTimeOut: "kenServerProjectProviderSetRequestTimeOut",
+	kenServerProjectProvider: "kenServerProjectProvider",
+	kenServerProjectProviderUseCacheProvider: "kenServerProjectProviderUseCacheProvider",
+	// LocalProjectProvider
+	kenLocalProjectProviderGetHighestVersion: "kenLocalProjectProviderGetHighestVersion",
+	kenLocalProjectProviderGetProject: "kenLocalProjectProviderGetProject",
+	kenLocalProjectProviderGetVariant: "kenLocalProjectProviderGetVariant",
+	kenLocalProjectProvider: "kenLocalProjectProvider",
+	kenLocalProjectProviderUseCacheProvider: "kenLocalProjectProviderUseCacheProvider",
+
+	// Quick Extractor
+	kenQEAddQuickExtractionListener: "kenQEAddQuickExtractionListener",
+	kenQERemoveQuickExtractionListener: "kenQERemoveQuickExtractionListener",
+	kenQEQuickExtract: "kenQEQuickExtract",
+	kenQESetQuickExtractionSettings: "kenQESetQuickExtractionSettings",
+	kenQEDestroy: "kenQEDestroy",
+
+	//Capture Server Action Names
+	kloCaptureServerCreate: "kloCaptureServerCreate",
+	kloCaptureServerCleanCaptureServer: "kloCaptureServerCleanCaptureServer",
+	kloCaptureServerRegisterDevice: "kloCaptureServerRegisterDevice",
+	kloCaptureServerLogin: "kloCaptureServerLogin",
+	kloCaptureServerLoginAnonymously: "kloCaptureServerLoginAnonymously",
+	kloCaptureServerLogout: "kloCaptureServerLogout",
+	kloCaptureServerCancelSubmission: "kloCaptureServerCancelSubmission",
+	kloCaptureServerSubmitDocument: "kloCaptureServerSubmitDocument",
+	kloCaptureServerSubmitDocumentStreaming: "kloCaptureServerSubmitDocumentStreaming",
+	kloCaptureServerResumeSubmission: "kloCaptureServerResumeSubmission",
+	kloCaptureServerGetResumableSubmissions: "kloCaptureServerGetResumableSubmissions",
+	kloCaptureServerEnqueueSubmission: "kloCaptureServerEnqueueSubmission",
+	kloCaptureServerSetSubmissionQueueOptions: "kloCaptureServerSetSubmissionQueueOptions",
+	kloCaptureServerGetQueuedSubmissions: "kloCaptureServerGetQueuedSubmissions",
+	kloCaptureServerGetSubmissionQueueStats: "kloCaptureServerGetSubmissionQueueStats",
+	kloCaptureServerGetDocumentType: "kloCaptureServerGetDocumentType",
+	kloCaptureServerSetProperties: "kloCaptureServerSetProperties",
+	kloCaptureServerGetProperties: "kloCaptureServerGetProperties",
+	kloCaptureServerStartJobService: "kloCaptureServerStartJobService",
+	kloCaptureServerSendImageService: "kloCaptureServerSendImageService",
+	kloCaptureServeraddProgressListener: "kloCaptureServeraddProgressListener",
+	kloCaptureServerremoveProgressListener: "kloCaptureServerremoveProgressListener",
+
+	//Document Types Array Action Names
+	kloCreateDocumentTypeWithFieldTypes: "kloCreateDocumentTypeWithFieldTypes",
+	kloDeleteDocumentTypes: "kloDeleteDocumentTypes",
+	kloRemoveAllDocumentTypes: "kloRemoveAllDocumentTypes",
+	kloGetDocumentTypes: "kloGetDocumentTypes",
+	kloGetDocumentTypeProperties: "kloGetDocumentTypeProperties",
+
+	//Documents Array Action Names
+	kloAddPageToDocument: "kloAddPageToDocument",
+	kloRemovePageFromDocument: "kloRemovePageFromDocument",
+	kloCreateDocumentWithDocumentType: "kloCreateDocumentWithDocumentType",
+	kloCreateDocumentWithDocumentTypeAndId: "kloCreateDocumentWithDocumentTypeAndId",
+	kloDeleteDocuments: "kloDeleteDocuments",
+	kloUpdateFields: "kloUpdateFields",
+	kloRemoveAllDocuments: "kloRemoveAllDocuments",
+	kloGetDocumentIds: "kloGetDocumentIds",
+	kloGetDocumentProperties: "kloGetDocumentProperties",
+	kloGetDocumentGraph: "kloGetDocumentGraph",
+	kloGetDocumentGraphDelta: "kloGetDocumentGraphDelta",
+
+	//Pages Array Action Names
+	kloCreatePageObject: "kloCreatePageObject",
+	kloAddImageToPage: "kloAddImageToPage",
+	kloRemoveImageFromPage: "kloRemoveImageFromPage",
+	kloDeletePages: "kloDeletePages",
+	kloGetPageIds: "kloGetPageIds",
+	kloRemoveAllPages: "kloRemoveAllPages",
+	kloGetPageProperties: "kloGetPageProperties",
+	kloSetPageProperties: "kloSetPageProperties",
+
+	//ServerExtractor Action Names
+	kloServerExtractorCreate: "kloServerExtractorCreate",
+	kloServerExtractorLogin: "kloServerExtractorLogin",
+	kloServerExtractorExtractData: "kloServerExtractorExtractData",
+	kloServerExtractorCancelExtraction: "kloServerExtractorCancelExtraction",
+	kloServerExtractorSetOptions: "kloServerExtractorSetOptions",
+	kloServerExtractorGetOptions: "kloServerExtractorGetOptions",
+	kloServerExtractorClean: "kloServerExtractorClean",
+
+	//App Stats Action Names
+	kutAppStatsStartRecord: "kutAppStatsStartRecord",
+	kutAppStatsStopRecord: "kutAppStatsStopRecord",
+	kutAppStatsWriteToFile: "kutAppStatsWriteToFile",
+	kutAppStatsSetOptions: "kutAppStatsSetOptions",
+	kutAppStatsGetOptions: "kutAppStatsGetOptions",
+	kutAppStatsPurge: "kutAppStatsPurge",
+	kutAppStatsIsRecording: "kutAppStatsIsRecording",
+	kutAppStatsExport: "kutAppStatsExport",
+	kutAppStatsAddAppStatsExportListener: "kutAppStatsAddAppStatsExportListener",
+	kutAppStatsAddAppStatsWriteFileListener: "kutAppStatsAddAppStatsWriteFileListener",
+	kutAppStatsAddAppThresholdListener: "kutAppStatsAddAppThresholdListener",
+	kutAppStatsRemoveAppStatsExportListener: "kutAppStatsRemoveAppStatsExportListener",
+	kutAppStatsRemoveAppStatsWriteFileListener: "kutAppStatsRemoveAppStatsWriteFileListener",
+	kutAppStatsRemoveAppStatsThresholdListener: "kutAppStatsRemoveAppStatsThresholdListener",
+	kutAppStatsBeginSession: "kutAppStatsBeginSession",
+	kutAppStatsLogSessionEvent: "kutAppStatsLogSessionEvent",
+	kutAppStatsLogSessionEvents: "kutAppStatsLogSessionEvents",
+	kutAppStatsEndSession: "kutAppStatsEndSession",
+
+	//Glare Remover
+	kenGRRemoveGlare: "kenGRRemoveGlare",
+	kenGRGetGlareFraction: "kenGRGetGlareFraction",
+	kenGRGetGlareFractions: "kenGRGetGlareFractions",
+	kenGRStartFusion: "kenGRStartFusion",
+	kenGRAddFusionFrame: "kenGRAddFusionFrame",
+	kenGRFinishFusion: "kenGRFinishFusion",
+	kenGRCancelFusion: "kenGRCancelFusion",
+
+	//NFCTagReader
+	kenNFCReadTag: "kenNFCReadTag",
+	kenNFCVerifyDocumentSecurityObject: "kenNFCVerifyDocumentSecurityObject",
+	kenNFCAddReadTagListener: "kenNFCAddReadTagListener",
+	kenNFCAddDetectTagListener: "kenNFCAddDetectTagListener",
+	kenNFCAddDocumentSecurityObjectVerificationListener: "kenNFCAddDocumentSecurityObjectVerificationListener",
+	kenNFCRemoveReadTagListener: "kenNFCRemoveReadTagListener",
+	kenNFCRemoveDetectTagListener: "kenNFCRemoveDetectTagListener",
+	kenNFCRemoveDocumentSecurityObjectVerificationListener: "kenNFCRemoveDocumentSecurityObjectVerificationListener",
+};
+
+// Ask for the native capabilities as soon as the plugin loads, so that gated calls rarely have to wait for the answer
+setTimeout(function () {
+	whenCapabilitiesKnown(function () {});
+}, 0);
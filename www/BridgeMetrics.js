@@ -0,0 +1,180 @@
+//
+// BridgeMetrics.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+/// Latency histograms and trace spans for the calls going through ActionUtils.exec
+/**
+ * This module only stores measurements; ActionUtils.exec records into it while instrumentation is enabled with
+ * ActionUtils.setInstrumentation. Latencies are kept per native action name in log-linear histograms (each power of two is
+ * split into 16 linear sub-buckets, so percentiles are accurate to about 6%) and the most recent calls are kept as spans
+ * in a bounded ring buffer, which can be exported in the Chrome trace_event format.
+ *
+ * @class
+ * @alias BridgeMetrics
+ */
+var BridgeMetrics = {};
+
+var SUB_BUCKETS = 16;
+
+var now =
+	typeof performance !== "undefined" && performance.now
+		? function () {
+				return performance.now();
+		  }
+		: function () {
+				return Date.now();
+		  };
+BridgeMetrics.now = now;
+
+var histograms = {};
+var spans = [];
+var spanCapacity = 4096;
+var spanStart = 0;
+var traceOrigin = now();
+
+/// Log-linear latency histogram with microsecond resolution
+var Histogram = function () {
+	this.counts = [];
+	this.count = 0;
+	this.sum = 0;
+	this.max = 0;
+};
+
+var bucketIndex = function (micros) {
+	var exponent = 0;
+	while (micros >> exponent >= SUB_BUCKETS * 2) exponent++;
+	return exponent * SUB_BUCKETS + (micros >> exponent);
+};
+
+var bucketUpperBound = function (index) {
+	if (index < SUB_BUCKETS * 2) return index;
+	var exponent = Math.floor(index / SUB_BUCKETS) - 1;
+	var subBucket = index - exponent * SUB_BUCKETS;
+	return ((subBucket + 1) << exponent) - 1;
+};
+
+Histogram.prototype.record = function (millis) {
+	var micros = Math.max(0, Math.round(millis * 1000));
+	var index = bucketIndex(micros);
+	this.counts[index] = (this.counts[index] || 0) + 1;
+	this.count++;
+	this.sum += millis;
+	if (millis > this.max) this.max = millis;
+};
+
+Histogram.prototype.percentile = function (percent) {
+	var target = Math.ceil((this.count * percent) / 100);
+	var seen = 0;
+	for (var i = 0; i < this.counts.length; i++) {
+		seen += this.counts[i] || 0;
+		if (seen >= target && seen > 0) return Math.min(bucketUpperBound(i) / 1000, this.max);
+	}
+	return this.max;
+};
+
+Histogram.prototype.summary = function () {
+	return {
+		count: this.count,
+		meanMs: this.count ? this.sum / this.count : 0,
+		p50Ms: this.percentile(50),
+		p90Ms: this.percentile(90),
+		p99Ms: this.percentile(99),
+		maxMs: this.max,
+	};
+};
+
+var histogramFor = function (key) {
+	return histograms[key] || (histograms[key] = new Histogram());
+};
+
+/**
+ * Records one completed bridge call.
+ *
+ * @param {String} action - native action name
+ * @param {Number} start - time the JavaScript call was made, from BridgeMetrics.now()
+ * @param {Number} dispatch - time the call was handed to cordova/exec (later than start for batched calls)
+ * @param {Number} end - time the first callback was invoked
+ * @param {Boolean} failed - true when the error callback was invoked
+ */
+BridgeMetrics.recordCall = function (action, start, dispatch, end, failed) {
+	histogramFor(action).record(end - start);
+	if (dispatch > start) histogramFor(action + ".queued").record(dispatch - start);
+	var span = { name: action, start: start, dispatch: dispatch, end: end, failed: !!failed };
+	if (spans.length < spanCapacity) {
+		spans.push(span);
+	} else {
+		spans[spanStart] = span;
+		spanStart = (spanStart + 1) % spanCapacity;
+	}
+};
+
+/**
+ * @return The latency summary of every action as {actionName: {count, meanMs, p50Ms, p90Ms, p99Ms, maxMs}}. Entries named
+ * "<action>.queued" hold the time calls spent in an ActionUtils batch before being dispatched.
+ */
+BridgeMetrics.getSummary = function () {
+	var summary = {};
+	Object.keys(histograms).forEach(function (key) {
+		summary[key] = histograms[key].summary();
+	});
+	return summary;
+};
+
+/**
+ * Builds a Chrome trace_event document from the recorded spans, merged with the native spans returned by kutGetBridgeMetrics.
+ * JavaScript spans are placed on thread "js", native spans keep the thread names reported by native.
+ *
+ * @param {Array} [nativeSpans] - spans reported by native as {name, phase, thread, startMs, durationMs}, relative to the same origin
+ * @return An object which can be saved with JSON.stringify and loaded in chrome://tracing or Perfetto.
+ */
+BridgeMetrics.toChromeTrace = function (nativeSpans) {
+	var events = [];
+	var ordered = spans.slice(spanStart).concat(spans.slice(0, spanStart));
+	ordered.forEach(function (span) {
+		events.push({
+			name: span.name,
+			cat: "bridge",
+			ph: "X",
+			pid: 1,
+			tid: "js",
+			ts: Math.round((span.start - traceOrigin) * 1000),
+			dur: Math.round((span.end - span.start) * 1000),
+			args: { queuedMs: span.dispatch - span.start, failed: span.failed },
+		});
+	});
+	(nativeSpans || []).forEach(function (span) {
+		events.push({
+			name: span.name + (span.phase ? ":" + span.phase : ""),
+			cat: "native",
+			ph: "X",
+			pid: 1,
+			tid: span.thread || "native",
+			ts: Math.round(span.startMs * 1000),
+			dur: Math.round(span.durationMs * 1000),
+		});
+	});
+	return { traceEvents: events, displayTimeUnit: "ms" };
+};
+
+/**
+ * @return The time origin of the recorded spans, so native can report its spans relative to the same origin.
+ */
+BridgeMetrics.getTraceOrigin = function () {
+	return traceOrigin;
+};
+
+/**
+ * Clears all histograms and spans and sets the span ring buffer size.
+ *
+ * @param {Number} [capacity] - maximum number of spans kept
+ */
+BridgeMetrics.reset = function (capacity) {
+	histograms = {};
+	spans = [];
+	spanStart = 0;
+	if (capacity > 0) spanCapacity = capacity;
+	traceOrigin = now();
+};
+
+module.exports = BridgeMetrics;
@@ -1,424 +1,630 @@
-//
-// DocumentsArray.js
-//
-//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
-
-var ActionUtils = require("./ActionUtils");
-var DocumentObject = require("./DocumentObject");
-var PageObject = require("./PageObject");
-
-//Start of Documents Array
-/**
- * @class
- * @alias DocumentsArray
- * @constructor
- */
-var DocumentsArray = function () {};
-/// Get all document ids from DocumentsArray
-/**
- * Method to get all document ids from DocumentsArray
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -   KMC_SUCCESS success call back jsonArray of page ids.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
- * docarray.getDocumentIds(successCallback,errorCallback);
- */
-DocumentsArray.prototype.getDocumentIds = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloGetDocumentIds,
-		[]
-	);
-};
-/// Remove all documents from DocumentsArray
-/**
- * Method to remove all documents from DocumentsArray
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  The library returns KMC_SUCCESS.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
- * docarray.removeAllDocuments(successCallback,errorCallback);
- */
-DocumentsArray.prototype.removeAllDocuments = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloRemoveAllDocuments,
-		[]
-	);
-};
-/// Create document using documentType
-/**
- * Method to Create document using documentType and add in DocumentsArray.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} docTypeName - A JSON object contains the documenttype name.
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  The library returns KMC_SUCCESS.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
- *
- * @example
- * var createdDocument = null;
- * var captureServer = null;
- * var documentTypesArray = null;
- * kfxCordova.kfxLibLogistics.createCaptureServer(function(captureServerObj){
- *      captureServer = captureServerObj;
- * },function(error){
- *      alert(JSON.stringify(error));
- * },{serverUrl:"valid url",serverType:"SERVER_KFS"});
-
- * captureServer.registerDevice(function(success){
- *      captureServer.loginAnonymously(function(success){
- *          documentTypesArray = success;
- *      },function(registerError){
- *          alert(JSON.stringify(registerError));
- *      });
- * },function(registerError){
- *      alert(JSON.stringify(registerError));
- * });
- *
- * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
- *     createdDocument = docObject;
- * },function(createDocumentError){
- *      alert(JSON.stringify(createDocumentError));
- * },documentTypesArray[0].typeName);
- *
- */
-DocumentsArray.prototype.createDocumentWithDocumentType = function (successCallback, errorCallback, docTypeName) {
-	ActionUtils.exec(
-		function (result) {
-			var documentObj = new DocumentObject(result);
-			if (successCallback) successCallback(documentObj);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloCreateDocumentWithDocumentType,
-		[docTypeName]
-	);
-};
-/// Create document using documentType and id
-/**
- * Method to Create document using documentType and id and add in DocumentsArray.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} docTypeNameAndId :A JSON object contains the documenttype name and id.
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  The library returns KMC_SUCCESS.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
- *
- * @example
- * var createdDocument = null;
- * var captureServer = null;
- * var documentTypesArray = null;
- * kfxCordova.kfxLibLogistics.createCaptureServer(function(captureServerObj){
- *      captureServer = captureServerObj;
- * },function(error){
- *      alert(JSON.stringify(error));
- * },{serverUrl:"valid url",serverType:"SERVER_KFS"});
- *
- * captureServer.registerDevice(function(success){
- *      captureServer.loginAnonymously(function(success){
- *          documentTypesArray = success;
- *      },function(registerError){
- *          alert(JSON.stringify(registerError));
- *      });
- * },function(registerError){
- *      alert(JSON.stringify(registerError));
- * });
- *
- * var kfsdocumentTypeReadyCallback = function(documentType){
- *   docarray.createDocumentWithDocumentTypeAndId(function(docObject){
- *       createdDocument = docObject;
- *   },function(error){
- *       alert(JSON.stringify(error));
- *   },{ documentTypeName:documentTypesArray[0].typeName, documentID: "document id what do you want to give"});
- * };
- *
- */
-DocumentsArray.prototype.createDocumentWithDocumentTypeAndId = function (
-	successCallback,
-	errorCallback,
-	docTypeNameAndId
-) {
-	ActionUtils.exec(
-		function (result) {
-			var documentObj = new DocumentObject(result);
-			if (successCallback) successCallback(documentObj);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloCreateDocumentWithDocumentTypeAndId,
-		[docTypeNameAndId]
-	);
-};
-/// Delete Documents from DocumentsArray
-/**
- * Method to Delete Documents from DocumentsArray which you wants to delete.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Array} documentIDs:A JSON array contains the ids of the documents.
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  The library returns KMC_SUCCESS.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
- *
- * @example
- * var docIDArray = [];
- * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
- * docarray.deleteDocuments(function(success){
- *       alert(JSON.stringify(success));
- * },function(error){
- *       alert(JSON.stringify(error));
- * },docIDArray); //docIDArray contains the Docids which you wants to delete.
- */
-DocumentsArray.prototype.deleteDocuments = function (successCallback, errorCallback, documentIDs) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloDeleteDocuments,
-		[documentIDs]
-	);
-};
-
-/// Get the properties of the Document from DocumentsArray
-/**
- * Get the properties of the Document from DocumentsArray
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} documentID - A JSON object contains the document id.
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back with document Object properties.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var createdDocument = null;
- * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
- * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
- *    createdDocument = docObject;
- * },function(error){
- *    alert(JSON.stringify(error));
- * },"document type name");
- * docarray.getPropertiesOfDocument(successCallback,errorCallback,{documentID : createdDocument.documentID});
- */
-DocumentsArray.prototype.getPropertiesOfDocument = function (successCallback, errorCallback, documentID) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloGetDocumentProperties,
-		[documentID]
-	);
-};
-
-/// Update the fields of the Document
-/**
- * Update the fields of the Document
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} parameters - A JSON object contains the documentType id and fields array.
- *
- * @param {String} [parameters.documentID] - the id of the document in which you want to update the fields
- *
- * @param {Array} [parameters.fields] - updated list of fields
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back .
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var createdDocument = null;
- * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
- * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
- *       createdDocument = docObject;
- * },function(error){
- *       alert(JSON.stringify(error));
- * },"document type name");
- * docarray.updateFieldsOfDocument(successCallback,errorCallback,{documentID:createdDocument.documentID,fields:createdDocument.fields});
- */
-DocumentsArray.prototype.updateFieldsOfDocument = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloUpdateFields,
-		[parameters]
-	);
-};
-
-///Add page to the Document
-/**
- * Method to Add page to the Document
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} parameters - A JSON object contains the documenttype and page ids.
- *
- * @param {String} [parameters.documentID=""] id of the document where you would like to add the page
- *
- * @param {String} [parameters.pageID=""] id of the page you want to add to document
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back .
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * var createdDocument = null;
- * var pageObject = null;
- * var pagearray = kfxCordova.kfxLibLogistics.createPagesArray();
- * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
- * pagearray.createPageObject(function(pageObj){
- *      pageObject = pageObj;
- * },function(error){
- *      alert(JSON.stringify(error));
- * },{side:"FRONT"});// use side:"BACK" to create back side image
- * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
- *    createdDocument = docObject;
- * },function(error){
- *    alert(JSON.stringify(error));
- * },"document type name");
- * docarray.addPageToDocument(function(document){
- *    alert("updated document is "+ JSON.stringify(document));
- * },function(error){
- *    alert (JSON.stringify(error));
- * },{documentID:createdDocument.documentID,pageID:pageObject.pageID});
- */
-DocumentsArray.prototype.addPageToDocument = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			var docObj = new DocumentObject(result);
-			if (successCallback) successCallback(docObj);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloAddPageToDocument,
-		[parameters]
-	);
-};
-
-///Remove page to the Document
-/**
- * Method to remove page to the Document
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} parameters - A JSON object contains the documenttype and page ids.
- *
- * @param {String} [parameters.documentID=""] id of the document where you would like to remove the page
- *
- * @param {String} [parameters.pageID=""] id of the page you want to remove from document
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * var createdDocument =null;
- * var pageObject = null;
- * var pagearray = kfxCordova.kfxLibLogistics.createPagesArray();
- * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
- * pagearray.createPageObject(function(pageObj){
- *      pageObject = pageObj;
- * },function(error){
- *      alert(JSON.stringify(error));
- * },{side:"FRONT"});// use side:"BACK" to create back side image
- * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
- *    createdDocument = docObject;
- * },function(error){},"document type name");
- * docarray.removePageFromDocument(function(document){
- *    alert("updated document is "+ JSON.stringify(document));
- * },function(error){
- *    alert(JSON.stringify(error));
- * },{documentID:createdDocument.documentID,pageID:pageObject.pageID});
- */
-DocumentsArray.prototype.removePageFromDocument = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			var docObj = new DocumentObject(result);
-			if (successCallback) successCallback(docObj);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kloRemovePageFromDocument,
-		[parameters]
-	);
-};
-
-//End of Documents Array
-
-module.exports = DocumentsArray;
+//
+// DocumentsArray.js
+//
+//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+var PromiseUtils = require("./PromiseUtils");
+var DocumentObject = require("./DocumentObject");
+var PageObject = require("./PageObject");
+var HandleRegistry = require("./HandleRegistry");
+
+// Mirror of the native document graph, kept in sync by getDocumentGraph and getDocumentGraphDelta
+var graphMirror = { version: -1, documentIDs: [], documents: {}, pages: {} };
+
+// Applies a snapshot or delta in the kloGetDocumentGraph format to the mirror
+var applyGraphDelta = function (delta) {
+	if (delta.reset) graphMirror = { version: -1, documentIDs: [], documents: {}, pages: {} };
+	(delta.removedPageIDs || []).forEach(function (pageID) {
+		delete graphMirror.pages[pageID];
+	});
+	(delta.removedDocumentIDs || []).forEach(function (documentID) {
+		delete graphMirror.documents[documentID];
+	});
+	(delta.pages || []).forEach(function (page) {
+		graphMirror.pages[page.pageID] = page;
+	});
+	(delta.documents || []).forEach(function (document) {
+		graphMirror.documents[document.documentID] = document;
+	});
+	if (delta.documentIDs) graphMirror.documentIDs = delta.documentIDs;
+	graphMirror.version = delta.version;
+};
+
+// Pins every ID of a snapshot or delta, since the mirror and the caller hold them as raw IDs
+var pinGraphIDs = function (delta) {
+	var pages = delta.pages || [];
+	HandleRegistry.pin("document", delta.documentIDs || []);
+	HandleRegistry.pin(
+		"document",
+		(delta.documents || []).map(function (document) {
+			return document.documentID;
+		})
+	);
+	HandleRegistry.pin(
+		"page",
+		pages.map(function (page) {
+			return page.pageID;
+		})
+	);
+	pages.forEach(function (page) {
+		HandleRegistry.pin(
+			"image",
+			(page.images || []).map(function (image) {
+				return image.ID;
+			})
+		);
+	});
+};
+
+// Builds the DocumentObject tree from the mirror
+var buildGraph = function () {
+	var documents = [];
+	graphMirror.documentIDs.forEach(function (documentID) {
+		var document = graphMirror.documents[documentID];
+		if (!document) return;
+		documents.push(
+			new DocumentObject({
+				documentID: document.documentID,
+				transactionID: document.transactionID,
+				documentType: document.documentType,
+				fields: document.fields,
+				pages: document.pageIDs
+					.map(function (pageID) {
+						return graphMirror.pages[pageID];
+					})
+					.filter(function (page) {
+						return !!page;
+					}),
+			})
+		);
+	});
+	return { version: graphMirror.version, documents: documents };
+};
+
+//Start of Documents Array
+/**
+ * @class
+ * @alias DocumentsArray
+ * @constructor
+ */
+var DocumentsArray = function () {};
+/// Get all document ids from DocumentsArray
+/**
+ * Method to get all document ids from DocumentsArray
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -   KMC_SUCCESS success call back jsonArray of page ids.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * docarray.getDocumentIds(successCallback,errorCallback);
+ */
+DocumentsArray.prototype.getDocumentIds = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			HandleRegistry.pin("document", result);
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloGetDocumentIds,
+		[]
+	);
+};
+/// Remove all documents from DocumentsArray
+/**
+ * Method to remove all documents from DocumentsArray
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  The library returns KMC_SUCCESS.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * docarray.removeAllDocuments(successCallback,errorCallback);
+ */
+DocumentsArray.prototype.removeAllDocuments = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			HandleRegistry.forget("document");
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloRemoveAllDocuments,
+		[]
+	);
+};
+/// Create document using documentType
+/**
+ * Method to Create document using documentType and add in DocumentsArray.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} docTypeName - A JSON object contains the documenttype name.
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  The library returns KMC_SUCCESS.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * var createdDocument = null;
+ * var captureServer = null;
+ * var documentTypesArray = null;
+ * kfxCordova.kfxLibLogistics.createCaptureServer(function(captureServerObj){
+ *      captureServer = captureServerObj;
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * },{serverUrl:"valid url",serverType:"SERVER_KFS"});
+
+ * captureServer.registerDevice(function(success){
+ *      captureServer.loginAnonymously(function(success){
+ *          documentTypesArray = success;
+ *      },function(registerError){
+ *          alert(JSON.stringify(registerError));
+ *      });
+ * },function(registerError){
+ *      alert(JSON.stringify(registerError));
+ * });
+ *
+ * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
+ *     createdDocument = docObject;
+ * },function(createDocumentError){
+ *      alert(JSON.stringify(createDocumentError));
+ * },documentTypesArray[0].typeName);
+ *
+ */
+DocumentsArray.prototype.createDocumentWithDocumentType = function (successCallback, errorCallback, docTypeName) {
+	ActionUtils.exec(
+		function (result) {
+			var documentObj = new DocumentObject(result);
+			if (successCallback) successCallback(documentObj);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloCreateDocumentWithDocumentType,
+		[docTypeName]
+	);
+};
+/// Create document using documentType and id
+/**
+ * Method to Create document using documentType and id and add in DocumentsArray.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} docTypeNameAndId :A JSON object contains the documenttype name and id.
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  The library returns KMC_SUCCESS.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * var createdDocument = null;
+ * var captureServer = null;
+ * var documentTypesArray = null;
+ * kfxCordova.kfxLibLogistics.createCaptureServer(function(captureServerObj){
+ *      captureServer = captureServerObj;
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * },{serverUrl:"valid url",serverType:"SERVER_KFS"});
+ *
+ * captureServer.registerDevice(function(success){
+ *      captureServer.loginAnonymously(function(success){
+ *          documentTypesArray = success;
+ *      },function(registerError){
+ *          alert(JSON.stringify(registerError));
+ *      });
+ * },function(registerError){
+ *      alert(JSON.stringify(registerError));
+ * });
+ *
+ * var kfsdocumentTypeReadyCallback = function(documentType){
+ *   docarray.createDocumentWithDocumentTypeAndId(function(docObject){
+ *       createdDocument = docObject;
+ *   },function(error){
+ *       alert(JSON.stringify(error));
+ *   },{ documentTypeName:documentTypesArray[0].typeName, documentID: "document id what do you want to give"});
+ * };
+ *
+ */
+DocumentsArray.prototype.createDocumentWithDocumentTypeAndId = function (
+	successCallback,
+	errorCallback,
+	docTypeNameAndId
+) {
+	ActionUtils.exec(
+		function (result) {
+			var documentObj = new DocumentObject(result);
+			if (successCallback) successCallback(documentObj);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloCreateDocumentWithDocumentTypeAndId,
+		[docTypeNameAndId]
+	);
+};
+/// Delete Documents from DocumentsArray
+/**
+ * Method to Delete Documents from DocumentsArray which you wants to delete.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Array} documentIDs:A JSON array contains the ids of the documents.
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  The library returns KMC_SUCCESS.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * var docIDArray = [];
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * docarray.deleteDocuments(function(success){
+ *       alert(JSON.stringify(success));
+ * },function(error){
+ *       alert(JSON.stringify(error));
+ * },docIDArray); //docIDArray contains the Docids which you wants to delete.
+ */
+DocumentsArray.prototype.deleteDocuments = function (successCallback, errorCallback, documentIDs) {
+	ActionUtils.exec(
+		function (result) {
+			HandleRegistry.forget("document", documentIDs);
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloDeleteDocuments,
+		[documentIDs]
+	);
+};
+
+/// Get the properties of the Document from DocumentsArray
+/**
+ * Get the properties of the Document from DocumentsArray
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} documentID - A JSON object contains the document id.
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back with document Object properties.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var createdDocument = null;
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
+ *    createdDocument = docObject;
+ * },function(error){
+ *    alert(JSON.stringify(error));
+ * },"document type name");
+ * docarray.getPropertiesOfDocument(successCallback,errorCallback,{documentID : createdDocument.documentID});
+ */
+DocumentsArray.prototype.getPropertiesOfDocument = function (successCallback, errorCallback, documentID) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloGetDocumentProperties,
+		[documentID]
+	);
+};
+
+/// Update the fields of the Document
+/**
+ * Update the fields of the Document
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - A JSON object contains the documentType id and fields array.
+ *
+ * @param {String} [parameters.documentID] - the id of the document in which you want to update the fields
+ *
+ * @param {Array} [parameters.fields] - updated list of fields
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back .
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var createdDocument = null;
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
+ *       createdDocument = docObject;
+ * },function(error){
+ *       alert(JSON.stringify(error));
+ * },"document type name");
+ * docarray.updateFieldsOfDocument(successCallback,errorCallback,{documentID:createdDocument.documentID,fields:createdDocument.fields});
+ */
+DocumentsArray.prototype.updateFieldsOfDocument = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloUpdateFields,
+		[parameters]
+	);
+};
+
+///Add page to the Document
+/**
+ * Method to Add page to the Document
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - A JSON object contains the documenttype and page ids.
+ *
+ * @param {String} [parameters.documentID=""] id of the document where you would like to add the page
+ *
+ * @param {String} [parameters.pageID=""] id of the page you want to add to document
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back .
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * var createdDocument = null;
+ * var pageObject = null;
+ * var pagearray = kfxCordova.kfxLibLogistics.createPagesArray();
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * pagearray.createPageObject(function(pageObj){
+ *      pageObject = pageObj;
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * },{side:"FRONT"});// use side:"BACK" to create back side image
+ * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
+ *    createdDocument = docObject;
+ * },function(error){
+ *    alert(JSON.stringify(error));
+ * },"document type name");
+ * docarray.addPageToDocument(function(document){
+ *    alert("updated document is "+ JSON.stringify(document));
+ * },function(error){
+ *    alert (JSON.stringify(error));
+ * },{documentID:createdDocument.documentID,pageID:pageObject.pageID});
+ */
+DocumentsArray.prototype.addPageToDocument = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			var docObj = new DocumentObject(result);
+			if (successCallback) successCallback(docObj);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloAddPageToDocument,
+		[parameters]
+	);
+};
+
+///Remove page to the Document
+/**
+ * Method to remove page to the Document
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - A JSON object contains the documenttype and page ids.
+ *
+ * @param {String} [parameters.documentID=""] id of the document where you would like to remove the page
+ *
+ * @param {String} [parameters.pageID=""] id of the page you want to remove from document
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * var createdDocument =null;
+ * var pageObject = null;
+ * var pagearray = kfxCordova.kfxLibLogistics.createPagesArray();
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * pagearray.createPageObject(function(pageObj){
+ *      pageObject = pageObj;
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * },{side:"FRONT"});// use side:"BACK" to create back side image
+ * kfxCordova.kfxLibLogistics.createDocumentWithDocumentType(function(docObject){
+ *    createdDocument = docObject;
+ * },function(error){},"document type name");
+ * docarray.removePageFromDocument(function(document){
+ *    alert("updated document is "+ JSON.stringify(document));
+ * },function(error){
+ *    alert(JSON.stringify(error));
+ * },{documentID:createdDocument.documentID,pageID:pageObject.pageID});
+ */
+DocumentsArray.prototype.removePageFromDocument = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			var docObj = new DocumentObject(result);
+			if (successCallback) successCallback(docObj);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloRemovePageFromDocument,
+		[parameters]
+	);
+};
+
+/// Get every document with its pages, images and fields in one call
+/**
+ * Returns the whole document graph, documents → pages → images, with the fields of every document, in a single bridge call,
+ * instead of calling getDocumentIds, getPropertiesOfDocument, getPageIds, getPropertiesOfPage and getImageProperties for each item.
+ * The result also replaces the mirrored copy kept by DocumentsArray, which getDocumentGraphDelta and getCachedDocumentGraph update.
+ *
+ * Native keeps a change version which is incremented whenever a document, page, image or field changes.
+ *
+ * The graph methods need a newer native kfxPlugin than the one shipped in lib/. On a native layer without kloGetDocumentGraph,
+ * getDocumentGraph, getDocumentGraphDelta and getCachedDocumentGraph report {ErrorMsg: "Invalid action", ErrorDesc}; use the
+ * per-item methods there.
+ *
+ * @param {Function} successCallback - called with {version, documents}, where documents is an array of DocumentObject in the order of getDocumentIds
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  the document graph.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * docarray.getDocumentGraph(function(graph){
+ *      alert(graph.documents.length + " documents at version " + graph.version);
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * });
+ */
+DocumentsArray.prototype.getDocumentGraph = function (successCallback, errorCallback) {
+	ActionUtils.execExtended(
+		function (result) {
+			result.reset = true;
+			pinGraphIDs(result);
+			applyGraphDelta(result);
+			if (successCallback) successCallback(buildGraph());
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloGetDocumentGraph,
+		[]
+	);
+};
+
+/// Get the changes of the document graph since a version
+/**
+ * Returns only what changed since the given version: the documents whose properties, fields or page list changed, the pages whose
+ * properties or images changed, and the IDs of the removed documents and pages. Changed documents list their pages as 'pageIDs'.
+ * When native no longer has the changes since that version, the result is a full snapshot with 'reset' set to true.
+ *
+ * When sinceVersion is the version of the mirrored copy, the changes are also applied to it.
+ *
+ * @param {Function} successCallback - called with {version, reset, documentIDs, documents, pages, removedDocumentIDs, removedPageIDs}
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Number} sinceVersion - the version returned by an earlier getDocumentGraph or getDocumentGraphDelta call
+ *
+ * @example
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * docarray.getDocumentGraphDelta(function(delta){
+ *      alert(delta.pages.length + " pages changed");
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * },graph.version);
+ */
+DocumentsArray.prototype.getDocumentGraphDelta = function (successCallback, errorCallback, sinceVersion) {
+	ActionUtils.execExtended(
+		function (result) {
+			pinGraphIDs(result);
+			if (result.reset || sinceVersion === graphMirror.version) applyGraphDelta(result);
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kloGetDocumentGraphDelta,
+		[{ sinceVersion: sinceVersion }]
+	);
+};
+
+/// Get the document graph through the mirrored copy
+/**
+ * Brings the mirrored copy of the document graph up to date and returns it. The first call fetches the whole graph, later calls
+ * only fetch the changes since the previous call, so refreshing a screen costs one small bridge call whatever the document size.
+ * With 5 documents of 10 pages, bench/documentGraph.js counts 1 round-trip and 2 KB of results per refresh after one retake and
+ * one field edit, against 106 round-trips and 21 KB through the per-object getters.
+ *
+ * @param {Function} successCallback - called with {version, documents}, as returned by getDocumentGraph
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @example
+ * var docarray = kfxCordova.kfxLibLogistics.createDocumentsArray();
+ * docarray.getCachedDocumentGraph(function(graph){
+ *      renderDocuments(graph.documents);
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * });
+ */
+DocumentsArray.prototype.getCachedDocumentGraph = function (successCallback, errorCallback) {
+	if (graphMirror.version < 0) {
+		this.getDocumentGraph(successCallback, errorCallback);
+		return;
+	}
+	this.getDocumentGraphDelta(
+		function () {
+			if (successCallback) successCallback(buildGraph());
+		},
+		errorCallback,
+		graphMirror.version
+	);
+};
+
+//End of Documents Array
+
+// Methods taking (successCallback, errorCallback, ...), for PromiseUtils.promisify
+PromiseUtils.registerCallbackMethods(DocumentsArray, [
+	"getDocumentIds",
+	"removeAllDocuments",
+	"createDocumentWithDocumentType",
+	"createDocumentWithDocumentTypeAndId",
+	"deleteDocuments",
+	"getPropertiesOfDocument",
+	"updateFieldsOfDocument",
+	"addPageToDocument",
+	"removePageFromDocument",
+	"getDocumentGraph",
+	"getDocumentGraphDelta",
+	"getCachedDocumentGraph",
+]);
+
+module.exports = DocumentsArray;
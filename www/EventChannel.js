@@ -0,0 +1,280 @@
+//
+// EventChannel.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+var BridgeMetrics = require("./BridgeMetrics");
+
+/// A single native to JavaScript event stream shared by the listeners of all plugin classes
+/**
+ * Without the channel every add*Listener method keeps its own long lived Cordova callback, and every event is encoded and
+ * dispatched on its own. Once the channel is open, the listeners which support it subscribe to one persistent kfxPlugin callback
+ * instead. Native packs the pending events into frames, [eventID, payload, eventID, payload, ...], where eventID is the small
+ * integer assigned to the subscription, and this class demultiplexes each frame to the listener callbacks.
+ *
+ * High frequency events, such as levelness and stability, are coalesced: native forwards at most one of them per coalesce interval,
+ * and when a frame still holds several events of such a subscription only the latest one is delivered, at its place in the frame.
+ * Listener callbacks get the same result objects as without the channel, with eventType "eventRaised".
+ *
+ * The channel needs a newer native kfxPlugin than the one shipped in lib/. On a native layer without it, open reports
+ * {ErrorMsg: "Invalid action", ErrorDesc} and the listeners keep their own callbacks.
+ *
+ * @class
+ * @alias EventChannel
+ */
+var EventChannel = {};
+
+// Listeners coalesced by default, latest value wins
+var defaultCoalesced = {};
+defaultCoalesced[ActionUtils.addLevelnessListener] = true;
+defaultCoalesced[ActionUtils.addStabilityDelayListener] = true;
+defaultCoalesced[ActionUtils.addFocusListener] = true;
+defaultCoalesced[ActionUtils.addTorchLuminanceListener] = true;
+
+// "closed", "opening" or "open"
+var channelState = "closed";
+var channelOptions = { coalesceInterval: 100 };
+// Subscriptions in the order they were made; each belongs to one plugin object and one add*Listener action
+var subscriptions = [];
+var subscriptionsByID = [];
+var subscriptionCounter = 0;
+var emptyStats = function () {
+	return {
+		framesReceived: 0,
+		eventsReceived: 0,
+		eventsDelivered: 0,
+		eventsCoalesced: 0,
+		dispatchMs: 0,
+		since: Date.now(),
+	};
+};
+var stats = emptyStats();
+
+var findSubscription = function (owner, action) {
+	for (var i = 0; i < subscriptions.length; i++) {
+		if (subscriptions[i].owner === owner && subscriptions[i].action === action) return subscriptions[i];
+	}
+	return null;
+};
+
+var removeSubscription = function (subscription) {
+	var index = subscriptions.indexOf(subscription);
+	if (index !== -1) subscriptions.splice(index, 1);
+	delete subscriptionsByID[subscription.eventID];
+};
+
+// Native sends the payload of the event alone; listeners expect the result object of their own Cordova callback
+var legacyResult = function (payload) {
+	if (payload === null || typeof payload !== "object" || payload.eventType) return payload;
+	var result = { eventType: "eventRaised" };
+	for (var key in payload) {
+		result[key] = payload[key];
+	}
+	return result;
+};
+
+var dispatchFrame = function (frame) {
+	var start = BridgeMetrics.now();
+	stats.framesReceived++;
+	// Position of the latest event of every coalesced subscription in the frame; earlier ones are skipped
+	var latest = {};
+	for (var i = 0; i < frame.length; i += 2) {
+		var coalesced = subscriptionsByID[frame[i]];
+		if (coalesced && coalesced.coalesce) latest[coalesced.eventID] = i;
+	}
+	for (var j = 0; j < frame.length; j += 2) {
+		var subscription = subscriptionsByID[frame[j]];
+		stats.eventsReceived++;
+		if (!subscription) continue;
+		if (subscription.coalesce && latest[subscription.eventID] !== j) {
+			stats.eventsCoalesced++;
+			continue;
+		}
+		stats.eventsDelivered++;
+		if (subscription.eventCallback) subscription.eventCallback(legacyResult(frame[j + 1]));
+	}
+	stats.dispatchMs += BridgeMetrics.now() - start;
+};
+
+/// To open the event channel.
+/**
+ * Opens the persistent event stream. Listeners added after this call are delivered through the channel; listeners added before
+ * keep their own callback until they are removed.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name, also called if the channel is closed by native
+ * @param {Object} [parameters] - A JSON object with the channel options
+ * @param {Number} [parameters.coalesceInterval = 100] - minimum time in milliseconds between two coalesced events of the same listener
+ * @param {Number} [parameters.maxFrameInterval = 16] - maximum time in milliseconds native holds events before sending a frame
+ *
+ * @example
+ * kfxCordova.EventChannel.open(successCallback, errorCallback, {coalesceInterval: 66});
+ * imgCaptureControl.addLevelnessListener(successCallback, errorCallback, levelnessCallback);
+ */
+EventChannel.open = function (successCallback, errorCallback, parameters) {
+	if (channelState !== "closed") {
+		if (errorCallback) {
+			errorCallback({
+				ErrorMsg: "KMC_EVENT_CHANNEL_ALREADY_OPEN",
+				ErrorDesc: "The event channel is already " + channelState,
+			});
+		}
+		return;
+	}
+	channelState = "opening";
+	if (parameters && parameters.coalesceInterval !== undefined) {
+		channelOptions.coalesceInterval = parameters.coalesceInterval;
+	}
+	ActionUtils.execExtended(
+		function (result) {
+			if (result.eventType === "eventRegistered") {
+				channelState = "open";
+				if (successCallback) successCallback(result);
+			} else if (result.eventType === "eventRaised") {
+				dispatchFrame(result.frame);
+			}
+		},
+		function (error) {
+			channelState = "closed";
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutOpenEventChannel,
+		[parameters || {}]
+	);
+};
+
+/// To close the event channel.
+/**
+ * Closes the event stream and removes every listener subscribed through it.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ */
+EventChannel.close = function (successCallback, errorCallback) {
+	channelState = "closed";
+	subscriptions = [];
+	subscriptionsByID = [];
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutCloseEventChannel,
+		[]
+	);
+};
+
+/**
+ * @return true when the channel is open and listeners are delivered through it.
+ */
+EventChannel.isOpen = function () {
+	return channelState === "open";
+};
+
+/**
+ * @param {Object} owner - the plugin object of the add*Listener method
+ * @param {String} action - the native action of the add*Listener method
+ * @return true when the listener of the given object and action is delivered through the channel.
+ */
+EventChannel.isSubscribed = function (owner, action) {
+	return !!findSubscription(owner, action);
+};
+
+/// To deliver a listener through the channel.
+/**
+ * Used by the add*Listener methods of the plugin classes. Replaces any earlier subscription of the same object and action.
+ *
+ * @param {Function} successCallback - called once native has registered the listener
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} owner - the plugin object whose add*Listener method is called
+ * @param {String} action - the native action of the add*Listener method, for example ActionUtils.addLevelnessListener
+ * @param {Function} eventCallback - called with every event of the listener
+ * @param {Array} [args] - the arguments the add*Listener method would send to native
+ */
+EventChannel.subscribe = function (successCallback, errorCallback, owner, action, eventCallback, args) {
+	var previous = findSubscription(owner, action);
+	if (previous) removeSubscription(previous);
+	var subscription = {
+		eventID: ++subscriptionCounter,
+		owner: owner,
+		action: action,
+		eventCallback: eventCallback,
+		coalesce: !!defaultCoalesced[action],
+	};
+	subscriptions.push(subscription);
+	subscriptionsByID[subscription.eventID] = subscription;
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			removeSubscription(subscription);
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutSubscribeEvent,
+		[
+			{
+				eventID: subscription.eventID,
+				action: action,
+				args: args || [],
+				coalesceInterval: subscription.coalesce ? channelOptions.coalesceInterval : 0,
+			},
+		]
+	);
+};
+
+/// To stop delivering a listener through the channel.
+/**
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} owner - the plugin object whose remove*Listener method is called
+ * @param {String} action - the native action of the add*Listener method
+ */
+EventChannel.unsubscribe = function (successCallback, errorCallback, owner, action) {
+	var subscription = findSubscription(owner, action);
+	if (subscription) removeSubscription(subscription);
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutUnsubscribeEvent,
+		[{ eventID: subscription ? subscription.eventID : 0, action: action }]
+	);
+};
+
+/// To get the delivery statistics of the channel.
+/**
+ * @return {framesReceived, eventsReceived, eventsDelivered, eventsCoalesced, eventsPerSecond, dispatchMs, averageDispatchMs}.
+ * 'eventsPerSecond' is the rate of events delivered to listeners since the statistics were reset, 'dispatchMs' the main thread
+ * time spent demultiplexing frames and running the listener callbacks, and 'eventsCoalesced' the number of events replaced by
+ * a later one of the same listener, which were never dispatched on the main thread.
+ */
+EventChannel.getStats = function () {
+	var seconds = (Date.now() - stats.since) / 1000;
+	return {
+		framesReceived: stats.framesReceived,
+		eventsReceived: stats.eventsReceived,
+		eventsDelivered: stats.eventsDelivered,
+		eventsCoalesced: stats.eventsCoalesced,
+		eventsPerSecond: seconds > 0 ? stats.eventsDelivered / seconds : 0,
+		dispatchMs: stats.dispatchMs,
+		averageDispatchMs: stats.eventsDelivered ? stats.dispatchMs / stats.eventsDelivered : 0,
+	};
+};
+
+/// To reset the delivery statistics of the channel.
+EventChannel.resetStats = function () {
+	stats = emptyStats();
+};
+
+module.exports = EventChannel;
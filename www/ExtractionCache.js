@@ -0,0 +1,357 @@
+//
+// ExtractionCache.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+
+/// Result cache shared by QuickExtractor and ServerExtractor
+/**
+ * Retrying an extraction on the same image, or submitting a byte identical image again from a retake flow, normally repeats the whole
+ * QuickExtractor.processImage inference or ServerExtractor.extractData round trip. When the cache is enabled, the library keys each
+ * extraction result by a hash of the image bytes combined with everything that can change the result:
+ *
+ * - QuickExtractor: the settings last set with setQuickExtractionSettings.
+ * - ServerExtractor: the server type and url, the options set with setOptions, and the 'params' of the extractData call.
+ * - Both: the optional 'cacheContext' string, for example the project and variant version, given to setOptions here or to extractData.
+ *
+ * A cache hit returns the stored result without inference or network access; QuickExtractor raises the extraction event as usual.
+ * Results returned from the cache carry 'fromCache' set to true. Entries are bounded by count, size and age. With 'persistent'
+ * set they are kept across launches in the application's private storage. Changing any part of the key makes the earlier entries
+ * unreachable, and they are evicted as the cache fills.
+ *
+ * The cache needs a newer native kfxPlugin than the one shipped in lib/. On a native layer without it, this class keeps a cache of
+ * the ServerExtractor results in JavaScript instead, with the same options, keys and counters. With 'persistent' set it stores the
+ * extracted data unencrypted in the WebView's localStorage, so leave it off for personal data such as identity documents. Its image
+ * hash reads every image through the bridge once per extractData call, which is cheap next to a server round trip. QuickExtractor
+ * results are not cached there.
+ *
+ * @class
+ * @alias ExtractionCache
+ */
+var ExtractionCache = {};
+
+var STORAGE_KEY = "kfxCordova.ExtractionCache";
+
+// Set once the native layer took the options, so the JavaScript cache stays out of the way
+var nativeCache = false;
+var options = {
+	enabled: false,
+	maxEntries: 200,
+	maxBytes: 8388608,
+	ttl: 86400000,
+	persistent: false,
+	cacheContext: null,
+};
+// Cached results by key as {result, bytes, time}, and their keys from least to most recently used
+var entries = {};
+var order = [];
+var totalBytes = 0;
+var counters = { hits: 0, misses: 0, evictions: 0, hitMs: 0, missMs: 0 };
+var loaded = false;
+
+var storage = function () {
+	try {
+		return options.persistent && typeof localStorage !== "undefined" ? localStorage : null;
+	} catch (e) {
+		return null;
+	}
+};
+
+var load = function () {
+	if (loaded) return;
+	loaded = true;
+	var store = storage();
+	if (!store) return;
+	try {
+		var saved = JSON.parse(store.getItem(STORAGE_KEY));
+		if (!saved) return;
+		order = saved.order;
+		entries = saved.entries;
+		totalBytes = saved.totalBytes;
+	} catch (e) {
+		entries = {};
+		order = [];
+		totalBytes = 0;
+	}
+};
+
+var save = function () {
+	var store = storage();
+	if (!store) return;
+	try {
+		store.setItem(STORAGE_KEY, JSON.stringify({ order: order, entries: entries, totalBytes: totalBytes }));
+	} catch (e) {
+		// Over the storage quota: the cache keeps working for this launch
+	}
+};
+
+var remove = function (key) {
+	totalBytes -= entries[key].bytes;
+	delete entries[key];
+	order.splice(order.indexOf(key), 1);
+};
+
+var evict = function () {
+	while (order.length > 0 && (order.length > options.maxEntries || totalBytes > options.maxBytes)) {
+		remove(order[0]);
+		counters.evictions++;
+	}
+};
+
+var lookup = function (key) {
+	var entry = entries[key];
+	if (!entry) return null;
+	if (Date.now() - entry.time > options.ttl) {
+		remove(key);
+		return null;
+	}
+	order.splice(order.indexOf(key), 1);
+	order.push(key);
+	return entry;
+};
+
+var store = function (key, result) {
+	if (entries[key]) remove(key);
+	var bytes = JSON.stringify(result).length * 2;
+	entries[key] = { result: result, bytes: bytes, time: Date.now() };
+	order.push(key);
+	totalBytes += bytes;
+	evict();
+	save();
+};
+
+// 53-bit content hash of the image bytes, as base64
+var hash = function (text) {
+	var h1 = 0xdeadbeef;
+	var h2 = 0x41c6ce57;
+	for (var i = 0; i < text.length; i++) {
+		var c = text.charCodeAt(i);
+		h1 = Math.imul(h1 ^ c, 2654435761);
+		h2 = Math.imul(h2 ^ c, 1597334677);
+	}
+	h1 = Math.imul(h1 ^ (h1 >>> 16), 2246822507) ^ Math.imul(h2 ^ (h2 >>> 13), 3266489909);
+	h2 = Math.imul(h2 ^ (h2 >>> 16), 2246822507) ^ Math.imul(h1 ^ (h1 >>> 13), 3266489909);
+	return (4294967296 * (2097151 & h2) + (h1 >>> 0)).toString(36) + ":" + text.length;
+};
+
+// Builds the key of an extractData call from the image bytes, the server extractor options and the call parameters
+var serverKey = function (parameters, successCallback, errorCallback) {
+	var imageIDs = parameters.imageIDs || [];
+	var hashes = [];
+	var next = function () {
+		if (hashes.length < imageIDs.length) {
+			ActionUtils.exec(
+				function (base64) {
+					hashes.push(hash(String(base64)));
+					next();
+				},
+				errorCallback,
+				ActionUtils.serviceName,
+				ActionUtils.getBase64ImageWithId,
+				[imageIDs[hashes.length]]
+			);
+			return;
+		}
+		ActionUtils.exec(
+			function (serverOptions) {
+				successCallback(
+					JSON.stringify([hashes, serverOptions, parameters.params, options.cacheContext, parameters.cacheContext])
+				);
+			},
+			errorCallback,
+			ActionUtils.serviceName,
+			ActionUtils.kloServerExtractorGetOptions,
+			[]
+		);
+	};
+	next();
+};
+
+// Cancelled or failed extractions are not cached
+var isComplete = function (result) {
+	if (!result) return false;
+	if (typeof result !== "string") return !result.ErrorMsg;
+	try {
+		var parsed = JSON.parse(result);
+		return !!parsed && !parsed.ErrorMsg;
+	} catch (e) {
+		return true;
+	}
+};
+
+var fromCache = function (result) {
+	if (typeof result !== "string") return Object.assign({}, result, { fromCache: true });
+	try {
+		var parsed = JSON.parse(result);
+		if (parsed && typeof parsed === "object" && !Array.isArray(parsed)) {
+			parsed.fromCache = true;
+			return JSON.stringify(parsed);
+		}
+	} catch (e) {
+		// Not JSON: returned as stored
+	}
+	return result;
+};
+
+var counterReport = function (entryCount, bytes, values) {
+	var lookups = values.hits + values.misses;
+	return {
+		hits: values.hits,
+		misses: values.misses,
+		hitRate: lookups ? values.hits / lookups : 0,
+		entries: entryCount,
+		bytes: bytes,
+		evictions: values.evictions,
+		averageHitMs: values.hits ? values.hitMs / values.hits : 0,
+		averageMissMs: values.misses ? values.missMs / values.misses : 0,
+	};
+};
+
+/**
+ * Runs a ServerExtractor.extractData call through the JavaScript cache. Called by ServerExtractor; 'extract' makes the native
+ * call with (successCallback, errorCallback).
+ */
+ExtractionCache.extractServerData = function (parameters, extract, successCallback, errorCallback) {
+	if (nativeCache || !options.enabled || !parameters || parameters.useCache === false) {
+		extract(successCallback, errorCallback);
+		return;
+	}
+	load();
+	var start = Date.now();
+	serverKey(
+		parameters,
+		function (key) {
+			var entry = lookup(key);
+			if (entry) {
+				counters.hits++;
+				counters.hitMs += Date.now() - start;
+				if (successCallback) successCallback(fromCache(entry.result));
+				return;
+			}
+			extract(function (result) {
+				counters.misses++;
+				counters.missMs += Date.now() - start;
+				if (isComplete(result)) store(key, result);
+				if (successCallback) successCallback(result);
+			}, errorCallback);
+		},
+		function () {
+			extract(successCallback, errorCallback);
+		}
+	);
+};
+
+/// To set the options of the extraction result cache.
+/**
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - A JSON object with the cache options. Options which are not given keep their current value.
+ * @param {Boolean} [parameters.enabled = false] - enables the cache for both extractors
+ * @param {Number} [parameters.maxEntries = 200] - maximum number of cached results
+ * @param {Number} [parameters.maxBytes = 8388608] - maximum total size in bytes of the cached results
+ * @param {Number} [parameters.ttl = 86400000] - time in milliseconds after which a result is no longer used
+ * @param {Boolean} [parameters.persistent = false] - keep the cache across application launches. Without the native cache, the
+ * results are then stored unencrypted in localStorage.
+ * @param {String} [parameters.cacheContext] - string added to every key, such as the project and variant version in use
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS if the options are set successfully.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
+ *
+ * @example
+ * kfxCordova.ExtractionCache.setOptions(successCallback, errorCallback, {enabled: true, ttl: 3600000, cacheContext: "MobileID-1.4"});
+ */
+ExtractionCache.setOptions = function (successCallback, errorCallback, parameters) {
+	ActionUtils.execExtended(
+		function (result) {
+			nativeCache = true;
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutSetExtractionCacheOptions,
+		[parameters],
+		function () {
+			Object.keys(parameters || {}).forEach(function (key) {
+				if (parameters[key] !== undefined) options[key] = parameters[key];
+			});
+			load();
+			evict();
+			if (successCallback) successCallback("KMC_SUCCESS");
+		}
+	);
+};
+
+/// To get the counters of the extraction result cache.
+/**
+ * @param {Function} successCallback - called with {QUICK, SERVER}, the counters of each extractor as {hits, misses, hitRate, entries,
+ * bytes, evictions, averageHitMs, averageMissMs}, where the latencies are measured from the extraction call to its result.
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @example
+ * kfxCordova.ExtractionCache.getStats(function(stats){
+ *       alert("server hit rate " + stats.SERVER.hitRate);
+ * },errorCallback);
+ */
+ExtractionCache.getStats = function (successCallback, errorCallback) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutGetExtractionCacheStats,
+		[],
+		function () {
+			load();
+			var none = { hits: 0, misses: 0, evictions: 0, hitMs: 0, missMs: 0 };
+			if (successCallback) {
+				successCallback({
+					QUICK: counterReport(0, 0, none),
+					SERVER: counterReport(order.length, totalBytes, counters),
+				});
+			}
+		}
+	);
+};
+
+/// To remove cached extraction results.
+/**
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} [extractor] - "QUICK" or "SERVER" to clear the results of one extractor only. Both are cleared when omitted.
+ *
+ * @example
+ * kfxCordova.ExtractionCache.clear(successCallback, errorCallback, "SERVER");
+ */
+ExtractionCache.clear = function (successCallback, errorCallback, extractor) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutClearExtractionCache,
+		[{ extractor: extractor || null }],
+		function () {
+			if (extractor !== "QUICK") {
+				entries = {};
+				order = [];
+				totalBytes = 0;
+				loaded = true;
+				save();
+			}
+			if (successCallback) successCallback("KMC_SUCCESS");
+		}
+	);
+};
+
+module.exports = ExtractionCache;
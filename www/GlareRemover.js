@@ -1,97 +1,342 @@
-//
-// GlareRemover.js
-//
-//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
-
-var ActionUtils = require("./ActionUtils");
-var ImageObject = require("./ImageObject");
-
-//Start of App Stats Methods
-/// The Plugin object for the native Glare Remover class
-/**
- * This GlareRemover class is responsible for handling the corresponding plugin js to interact with the native Glare Remover
- * class. To set and get the properties, and to access the instance methods, corresponding JS methods are written under this class which
- * are used by the end user in application script.
- * Use the Glare Remover object for removing the glare from images.
- *
- * @class
- * @alias GlareRemover
- * @constructor
- */
-var GlareRemover = function () {};
-
-/// Get the glare fraction for a given image.
-/**
- * User calls this method to get the amount of glare on an image.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Array} imageID: image ID that should be passed to get the glare fraction.
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  The library returns glare fraction.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var glareRemover = kfxCordova.kfxEngine.createGlareRemover();
- * glareRemover.getGlareFraction(successCallback,errorCallback,"ImageID");
- */
-GlareRemover.prototype.getGlareFraction = function (successCallback, errorCallback, imageID) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenGRGetGlareFraction,
-		[imageID]
-	);
-};
-
-/// Remove glare on the iamges which are passed in.
-/**
- * User calls this method to remove glare using the passed in images.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Array} imageIDs: A List of image IDs you would like to remove the glare. Should pass in two of these objects captured at different angles so that glare would be distributed at different places. Of these, the reference image that user wants to perform glare removal should be passed as the first object of the array.
- *
- * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  The library returns glare free image.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var glareRemover = kfxCordova.kfxEngine.createGlareRemover();
- * glareRemover.removeGlare(successCallback,errorCallback,["ImageID1","ImageID2"]);
- */
-GlareRemover.prototype.removeGlare = function (successCallback, errorCallback, imageIDs) {
-	ActionUtils.exec(
-		function (result) {
-			var glareFreeImage = new ImageObject(result);
-			if (successCallback) successCallback(glareFreeImage);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenGRRemoveGlare,
-		[imageIDs]
-	);
-};
-
-//End of Glare Remover methods
-module.exports = GlareRemover;
+//
+// GlareRemover.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+var PromiseUtils = require("./PromiseUtils");
+var ImageObject = require("./ImageObject");
+
+//Start of App Stats Methods
+/// The Plugin object for the native Glare Remover class
+/**
+ * This GlareRemover class is responsible for handling the corresponding plugin js to interact with the native Glare Remover
+ * class. To set and get the properties, and to access the instance methods, corresponding JS methods are written under this class which
+ * are used by the end user in application script.
+ * Use the Glare Remover object for removing the glare from images.
+ *
+ * @class
+ * @alias GlareRemover
+ * @constructor
+ */
+var GlareRemover = function () {};
+
+/// Get the glare fraction for a given image.
+/**
+ * User calls this method to get the amount of glare on an image.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Array} imageID: image ID that should be passed to get the glare fraction.
+ * @param {Object} [options] - A JSON object with the glare analysis options. The image is split into tiles which are analysed in parallel.
+ * @param {Object} [options.roi] - region of interest {x, y, width, height} in image pixels. Only the tiles inside it are analysed and the fraction is relative to its area.
+ * @param {Boolean} [options.documentBoundsOnly = false] - restrict the analysis to the document detected in the image. Ignored when roi is given.
+ * @param {Number} [options.tileSize = 128] - width and height of a tile in pixels
+ * @param {Number} [options.threads = 0] - number of threads analysing tiles, 0 to use one per core
+ * @param {Boolean} [options.includeTileMap = false] - also return the glare fraction of every tile
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  The library returns glare fraction. With options.includeTileMap, a JSON object {glareFraction, tileSize, columns, rows, tiles}, where tiles holds the glare fraction of each tile row by row.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var glareRemover = kfxCordova.kfxEngine.createGlareRemover();
+ * glareRemover.getGlareFraction(successCallback,errorCallback,"ImageID");
+ * glareRemover.getGlareFraction(successCallback,errorCallback,"ImageID",{documentBoundsOnly: true});
+ */
+GlareRemover.prototype.getGlareFraction = function (successCallback, errorCallback, imageID, options) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenGRGetGlareFraction,
+		options ? [imageID, options] : [imageID]
+	);
+};
+
+/// Remove glare on the iamges which are passed in.
+/**
+ * User calls this method to remove glare using the passed in images.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Array} imageIDs: A List of image IDs you would like to remove the glare. Should pass in two of these objects captured at different angles so that glare would be distributed at different places. Of these, the reference image that user wants to perform glare removal should be passed as the first object of the array.
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  The library returns glare free image.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var glareRemover = kfxCordova.kfxEngine.createGlareRemover();
+ * glareRemover.removeGlare(successCallback,errorCallback,["ImageID1","ImageID2"]);
+ */
+GlareRemover.prototype.removeGlare = function (successCallback, errorCallback, imageIDs) {
+	ActionUtils.exec(
+		function (result) {
+			var glareFreeImage = new ImageObject(result);
+			if (successCallback) successCallback(glareFreeImage);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenGRRemoveGlare,
+		[imageIDs]
+	);
+};
+
+/// Get the glare fraction of several images.
+/**
+ * Analyses the images in one call, with the tiles of all images shared by the same thread pool.
+ *
+ * kenGRGetGlareFractions needs a newer native kfxPlugin than the one shipped in lib/. On a native layer without it, each image is
+ * analysed with its own getGlareFraction call and the result is the same array.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Array} imageIDs - IDs of the images to analyse
+ * @param {Object} [options] - glare analysis options, as for getGlareFraction
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  An array with the result of each image, in the order of imageIDs.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * var glareRemover = kfxCordova.kfxEngine.createGlareRemover();
+ * glareRemover.getGlareFractions(successCallback,errorCallback,["ImageID1","ImageID2"],{documentBoundsOnly: true});
+ */
+GlareRemover.prototype.getGlareFractions = function (successCallback, errorCallback, imageIDs, options) {
+	var self = this;
+	var failed = false;
+	var fail = function (error) {
+		if (failed) return;
+		failed = true;
+		if (errorCallback) errorCallback(error);
+	};
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		fail,
+		ActionUtils.serviceName,
+		ActionUtils.kenGRGetGlareFractions,
+		[imageIDs, options || {}],
+		function () {
+			var results = new Array(imageIDs.length);
+			var remaining = imageIDs.length;
+			if (!remaining && successCallback) successCallback(results);
+			imageIDs.forEach(function (imageID, index) {
+				self.getGlareFraction(
+					function (result) {
+						results[index] = result;
+						if (--remaining === 0 && !failed && successCallback) successCallback(results);
+					},
+					fail,
+					imageID,
+					options
+				);
+			});
+		}
+	);
+};
+
+/// Start removing glare from frames as they are captured.
+/**
+ * removeGlare waits for the whole set of images. With glare fusion, each frame is merged into the result as soon as it is added with
+ * addGlareFusionFrame, so the work overlaps with the capture of the next frame, and capture can stop once the residual glare is low enough.
+ * One fusion can be in progress per GlareRemover: while one is, startGlareFusion calls the errorCallback with
+ * {ErrorMsg: "KMC_GR_FUSION_IN_PROGRESS", ErrorDesc} and the fusion in progress is left as it is.
+ *
+ * Glare fusion needs a newer native kfxPlugin than the one shipped in lib/. On a native layer without it, the fusion methods call the
+ * errorCallback with {ErrorMsg: "Invalid action", ErrorDesc}; use removeGlare there.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} [options] - A JSON object with the fusion options
+ * @param {Boolean} [options.documentBoundsOnly = true] - only fuse the document detected in the reference frame
+ * @param {Number} [options.threads = 0] - number of threads, 0 to use one per core
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS when the fusion has started.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ *
+ * @example
+ * var glareRemover = kfxCordova.kfxEngine.createGlareRemover();
+ * glareRemover.startGlareFusion(function(){
+ *      glareRemover.addGlareFusionFrame(function(progress){
+ *           if (progress.residualGlareFraction < 0.01) glareRemover.finishGlareFusion(successCallback, errorCallback);
+ *      },errorCallback,"ReferenceImageID");
+ * },errorCallback);
+ */
+GlareRemover.prototype.startGlareFusion = function (successCallback, errorCallback, options) {
+	var self = this;
+	if (self.fusionWaiters || self.fusionID) {
+		if (errorCallback) {
+			errorCallback({
+				ErrorMsg: "KMC_GR_FUSION_IN_PROGRESS",
+				ErrorDesc: "A glare fusion is already in progress",
+			});
+		}
+		return;
+	}
+	self.fusionWaiters = [];
+	var release = function () {
+		var waiters = self.fusionWaiters;
+		self.fusionWaiters = null;
+		return waiters;
+	};
+	ActionUtils.execExtended(
+		function (result) {
+			self.fusionID = result.fusionID;
+			release().forEach(function (waiter) {
+				waiter.callback(self.fusionID);
+			});
+			if (successCallback) successCallback("KMC_SUCCESS");
+		},
+		function (error) {
+			release().forEach(function (waiter) {
+				if (waiter.errorCallback) waiter.errorCallback(error);
+			});
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenGRStartFusion,
+		[options || {}]
+	);
+};
+
+// Calls back with the ID of the fusion in progress, once the startGlareFusion call in flight has received it
+var whenFusionStarted = function (glareRemover, callback, errorCallback) {
+	if (glareRemover.fusionWaiters) {
+		glareRemover.fusionWaiters.push({ callback: callback, errorCallback: errorCallback });
+		return;
+	}
+	callback(glareRemover.fusionID);
+};
+
+/// Merge a frame into the glare fusion in progress.
+/**
+ * The first frame added is the reference image; the following frames only contribute where the reference has glare. Frames added
+ * before startGlareFusion has called back are sent once the fusion has started, in the order they were added.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - ID of the frame to merge
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  A JSON object {framesMerged, residualGlareFraction}, where residualGlareFraction is the glare remaining in the fused image.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ */
+GlareRemover.prototype.addGlareFusionFrame = function (successCallback, errorCallback, imageID) {
+	whenFusionStarted(
+		this,
+		function (fusionID) {
+			ActionUtils.execExtended(
+				function (result) {
+					if (successCallback) successCallback(result);
+				},
+				function (error) {
+					if (errorCallback) errorCallback(error);
+				},
+				ActionUtils.serviceName,
+				ActionUtils.kenGRAddFusionFrame,
+				[fusionID, imageID]
+			);
+		},
+		errorCallback
+	);
+};
+
+/// Finish the glare fusion in progress.
+/**
+ * The fusion stays in progress when finishing fails, so the call can be retried.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  The library returns glare free image.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Exception,KmcException,JSONException.
+ */
+GlareRemover.prototype.finishGlareFusion = function (successCallback, errorCallback) {
+	var self = this;
+	whenFusionStarted(
+		this,
+		function (fusionID) {
+			ActionUtils.execExtended(
+				function (result) {
+					if (self.fusionID === fusionID) self.fusionID = null;
+					var glareFreeImage = new ImageObject(result);
+					if (successCallback) successCallback(glareFreeImage);
+				},
+				function (error) {
+					if (errorCallback) errorCallback(error);
+				},
+				ActionUtils.serviceName,
+				ActionUtils.kenGRFinishFusion,
+				[fusionID]
+			);
+		},
+		errorCallback
+	);
+};
+
+/// Cancel the glare fusion in progress.
+/**
+ * The fusion stays in progress when cancelling fails, so the call can be retried.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ */
+GlareRemover.prototype.cancelGlareFusion = function (successCallback, errorCallback) {
+	var self = this;
+	whenFusionStarted(
+		this,
+		function (fusionID) {
+			ActionUtils.execExtended(
+				function (result) {
+					if (self.fusionID === fusionID) self.fusionID = null;
+					if (successCallback) successCallback(result);
+				},
+				function (error) {
+					if (errorCallback) errorCallback(error);
+				},
+				ActionUtils.serviceName,
+				ActionUtils.kenGRCancelFusion,
+				[fusionID]
+			);
+		},
+		errorCallback
+	);
+};
+
+//End of Glare Remover methods
+
+// Methods taking (successCallback, errorCallback, ...), for PromiseUtils.promisify
+PromiseUtils.registerCallbackMethods(GlareRemover, [
+	"getGlareFraction",
+	"removeGlare",
+	"getGlareFractions",
+	"startGlareFusion",
+	"addGlareFusionFrame",
+	"finishGlareFusion",
+	"cancelGlareFusion",
+]);
+
+module.exports = GlareRemover;
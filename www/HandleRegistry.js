@@ -0,0 +1,216 @@
+//
+// HandleRegistry.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+
+/// Lifetime tracking of the native images, pages and documents referenced from JavaScript
+/**
+ * Objects which are never passed to removeImages, deletePages or deleteDocuments keep their native memory for the lifetime of
+ * the application. With automatic release enabled, this class releases the native object once every JavaScript object carrying
+ * its ID has been garbage collected, using FinalizationRegistry where the WebView supports it. Only enable it when the
+ * application keeps the objects themselves and not just their IDs, since an ID string alone does not keep the object alive.
+ * An ID which reached JavaScript untracked, through an object created while automatic release was off or as a raw ID from
+ * getImageIDs, getPageIds, getDocumentIds or the document graph methods, is pinned and never released automatically. Pins are
+ * dropped when the object is removed explicitly.
+ *
+ * Automatic release and the native part of getLiveObjectReport need a newer native kfxPlugin than the one shipped in lib/.
+ * On a native layer without kutReleaseHandles the releases fail and are counted in the report.
+ *
+ * getLiveObjectReport lists the native objects still alive, so leaks can be found in long running sessions.
+ *
+ * @class
+ * @alias HandleRegistry
+ */
+var HandleRegistry = {};
+
+var autoRelease = { image: false, page: false, document: false };
+var references = { image: {}, page: {}, document: {} };
+var pinned = { image: {}, page: {}, document: {} };
+var pendingRelease = null;
+var releasedCount = 0;
+var staleCount = 0;
+var releaseFailedCount = 0;
+var lastReleaseError = null;
+
+var registry =
+	typeof FinalizationRegistry !== "undefined"
+		? new FinalizationRegistry(function (held) {
+				HandleRegistry.unreference(held.kind, held.id);
+		  })
+		: null;
+
+var flushRelease = function () {
+	var handles = pendingRelease;
+	pendingRelease = null;
+	ActionUtils.execExtended(
+		function (result) {
+			releasedCount += result.released || 0;
+			staleCount += result.stale || 0;
+		},
+		function (error) {
+			releaseFailedCount += handles.image.length + handles.page.length + handles.document.length;
+			lastReleaseError = error;
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutReleaseHandles,
+		[handles]
+	);
+};
+
+/**
+ * Registers a JavaScript object carrying a native ID. Called by the ImageObject, PageObject and DocumentObject constructors.
+ *
+ * @param {Object} object - the JavaScript object
+ * @param {String} kind - "image", "page" or "document"
+ * @param {String} id - the native ID
+ */
+HandleRegistry.track = function (object, kind, id) {
+	if (!id || pinned[kind][id]) return;
+	if (!registry || !autoRelease[kind]) {
+		HandleRegistry.pin(kind, [id]);
+		return;
+	}
+	references[kind][id] = (references[kind][id] || 0) + 1;
+	registry.register(object, { kind: kind, id: id });
+};
+
+/**
+ * Excludes native IDs from automatic release, because JavaScript may hold them without a tracked object. Called for every ID
+ * which reaches JavaScript untracked.
+ *
+ * @param {String} kind - "image", "page" or "document"
+ * @param {Array} ids - the native IDs
+ */
+HandleRegistry.pin = function (kind, ids) {
+	if (!pinned[kind] || !Array.isArray(ids)) return;
+	ids.forEach(function (id) {
+		pinned[kind][id] = true;
+		delete references[kind][id];
+	});
+};
+
+/**
+ * Forgets native IDs which were removed explicitly, so they are neither kept pinned nor released a second time. Called once
+ * removeImages, deletePages, deleteDocuments and the removeAll methods have succeeded.
+ *
+ * @param {String} kind - "image", "page" or "document"
+ * @param {Array} [ids] - the removed native IDs, all the IDs of the kind when absent
+ */
+HandleRegistry.forget = function (kind, ids) {
+	if (!pinned[kind]) return;
+	if (!Array.isArray(ids)) {
+		pinned[kind] = {};
+		references[kind] = {};
+		if (pendingRelease) pendingRelease[kind] = [];
+		return;
+	}
+	ids.forEach(function (id) {
+		delete pinned[kind][id];
+		delete references[kind][id];
+	});
+	if (pendingRelease) {
+		pendingRelease[kind] = pendingRelease[kind].filter(function (id) {
+			return ids.indexOf(id) < 0;
+		});
+	}
+};
+
+/**
+ * Drops one reference to a native ID. The native object is released when the last reference is dropped; releases are
+ * sent to native together at the end of the current JavaScript turn.
+ *
+ * @param {String} kind - "image", "page" or "document"
+ * @param {String} id - the native ID
+ */
+HandleRegistry.unreference = function (kind, id) {
+	var count = references[kind][id];
+	if (!count) return;
+	if (count > 1) {
+		references[kind][id] = count - 1;
+		return;
+	}
+	delete references[kind][id];
+	if (!pendingRelease) {
+		pendingRelease = { image: [], page: [], document: [] };
+		Promise.resolve().then(flushRelease);
+	}
+	pendingRelease[kind].push(id);
+};
+
+/// To enable or disable the automatic release of native objects.
+/**
+ * Only objects created after automatic release is enabled are tracked. IDs already seen by JavaScript stay pinned.
+ *
+ * @param {Object} parameters - {images: Boolean, pages: Boolean, documents: Boolean}
+ *
+ * @return false when the WebView does not support FinalizationRegistry, in which case nothing is released automatically.
+ *
+ * @example
+ * kfxCordova.HandleRegistry.setAutoRelease({images: true});
+ */
+HandleRegistry.setAutoRelease = function (parameters) {
+	autoRelease.image = !!parameters.images;
+	autoRelease.page = !!parameters.pages;
+	autoRelease.document = !!parameters.documents;
+	return !!registry;
+};
+
+/// To get the native objects which are still alive.
+/**
+ * @param {Function} successCallback - called with {objects, totalBytes, releasedCount, staleCount, releaseFailedCount,
+ * lastReleaseError}. 'objects' lists every live image, page and document as {kind, id, bytes, ageMs, jsReferences}, largest first,
+ * where jsReferences is the number of tracked JavaScript objects still carrying the ID. 'releasedCount' and 'staleCount' count the
+ * automatic releases, and the handles which had already been released explicitly. 'releaseFailedCount' counts the handles whose
+ * release native failed, the last failure being 'lastReleaseError'. On a native layer without kutGetLiveObjectReport, 'objects'
+ * lists only the tracked IDs, as {kind, id, jsReferences}, and 'totalBytes' is absent.
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @example
+ * kfxCordova.HandleRegistry.getLiveObjectReport(function(report){
+ *       report.objects.filter(function(object){ return object.ageMs > 600000; }).forEach(function(object){
+ *             console.log("possible leak " + object.kind + " " + object.id + " " + object.bytes);
+ *       });
+ * },errorCallback);
+ */
+HandleRegistry.getLiveObjectReport = function (successCallback, errorCallback) {
+	var report = function (result) {
+		result.releasedCount = releasedCount;
+		result.staleCount = staleCount;
+		result.releaseFailedCount = releaseFailedCount;
+		result.lastReleaseError = lastReleaseError;
+		if (successCallback) successCallback(result);
+	};
+	ActionUtils.execExtended(
+		function (result) {
+			var objects = result.objects || [];
+			objects.forEach(function (object) {
+				var kindReferences = references[object.kind];
+				object.jsReferences = (kindReferences && kindReferences[object.id]) || 0;
+			});
+			objects.sort(function (a, b) {
+				return b.bytes - a.bytes;
+			});
+			result.objects = objects;
+			report(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutGetLiveObjectReport,
+		[],
+		function () {
+			var objects = [];
+			Object.keys(references).forEach(function (kind) {
+				Object.keys(references[kind]).forEach(function (id) {
+					objects.push({ kind: kind, id: id, jsReferences: references[kind][id] });
+				});
+			});
+			report({ objects: objects });
+		}
+	);
+};
+
+module.exports = HandleRegistry;
@@ -1,708 +1,1137 @@
-//
-// ImageArray.js
-//
-//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
-
-var ActionUtils = require("./ActionUtils");
-var ImageObject = require("./ImageObject");
-
-/// An User defined  class  to handle the image conversion operation.
-/**
- * This class is defined to handle the Image related operations. As native SDK expected inputs for all of the classes as KEDImages,
- * we had to define a mechanism to convert the Images to KEDImages and also to show a preview we need a format that can understood
- * by the top level (HTML) code. This class defines methods to convert image from base64 string to KEDImage, vice versa and other
- * supporting methods.
- *
- * The Image Array class maintains the Array of image objects and indexing on the image id of the KEDImage. When a base64 is sent
- * as input, a KEDImage is created and the imageid along with the KEDImage is added to the ImageArray class.
- *
- * For retrieving the KEDImage, please provide the imageid as input.
- *
- * Due to memory constraints, there is limitation on the number of Images that can be stored on the ImageArray object.
- * Limiting to 3/4 images is advised. This is a singleton class in native. Listed below are the plugin js methods to access the
- * methods of the ImageArray class.
- *
- * @class
- * @alias ImageArray
- * @constructor
- */
-//ImageArray constructor and corresponding methods
-var ImageArray = function () {};
-
-/// To get the total number of images  stored in ImageArray.
-/**
- * Method to get the number of images  stored in the ImageArray
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back will have the count of the total images stored in the ImageArray.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a string giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getTotalImages(successCallback,errorCallback);
- */
-ImageArray.prototype.getTotalImages = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getTotalImages,
-		[]
-	);
-};
-/// To get the raw binary data buffer of the KEDImage.
-/**
- * Method to get the raw binary data buffer of the KEDImage.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} imageID - image ID you would like to get the bytes array
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back will have ArrayBuffer of the image i.e byte[] of image.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong ImageID, Blob conversion failed, KmcRuntimeException & Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getImageAsBlob(successCallback,errorCallback,"imageID");
- */
-ImageArray.prototype.getImageAsBlob = function (successCallback, errorCallback, imageID) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getImageAsBlob,
-		[imageID]
-	);
-};
-
-/// To get the ids of the  images stored in ImageArray.
-/**
- * Method to get the image IDs of the images stored in ImageArray
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back will have the array of the Imageids from the image array.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getImageIDs(successCallback,errorCallback);
- */
-ImageArray.prototype.getImageIDs = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getImageIds,
-		[]
-	);
-};
-
-/// To get the properties of an image  in ImageArray.
-/**
- * Method to get the properties of an image in ImageArray.
- *
- * This method would get all the properties of an image which is stored in the ImageArray.
- * This would take the imageID as the input and send back all the properties of that image in the success call back, if that exists. Otherwise,
- * it would call the error call back method
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} ImageID - ID of the image of which you want to get the properties.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back will have the the properties of the 'Image' object in the form of JSON.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getImageProperties(successCallback,errorCallback,"ImageID");
- */
-ImageArray.prototype.getImageProperties = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getImagePropertiesWithId,
-		[parameters]
-	);
-};
-
-/// To convert a base64 string (of an image) to KEDImage
-/**
- * Method to convert an image in the form of base64string to a KEDImage. The KEDImage is stored in the ImageArray and the
- * corresponding id is returned in the call back.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} base64String - an input image in the form of base64 string to be converted to KEDImage
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back will have the image id of the converted KEDImage(from input base64 string).
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getImageFromBase64(successCallback,errorCallback, 'base64string');
- */
-ImageArray.prototype.getImageFromBase64 = function (successCallback, errorCallback, base64String) {
-	ActionUtils.exec(
-		function (result) {
-			var imgObject = new ImageObject(result);
-			if (successCallback) successCallback(imgObject);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getImageFromBase64,
-		[base64String]
-	);
-};
-
-/// To create a KEDImage from a specified file location
-/**
- * Method to create and store a KEDImage in the ImageArray. The KEDImage is created from the image specified in the input
- * file location.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} filePath - String variable representing a physical location of an image which need to be converted to a KEDImage
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back will have the image id of the converted KEDImage(from input image mentioned in the file path )
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getImageFromFilePath(successCallback,errorCallback, 'filepath of any image');
- */
-ImageArray.prototype.getImageFromFilePath = function (successCallback, errorCallback, filePath) {
-	ActionUtils.exec(
-		function (result) {
-			var imgObject = new ImageObject(result);
-			if (successCallback) successCallback(imgObject);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getImageFromFilepath,
-		[filePath]
-	);
-};
-
-/// To get the base64 string (of an image) from a KEDImage in the ImageArray
-/**
- * Method to get a base64 string of KEDImage which is already present in the ImageArray. If no KEDImage is found fro the
- * provided input image id, error will be returned
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} ImageID - ID of the image of which you want to get the base64 string.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back will have the base64 string of the input image id.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getImageToBase64(successCallback,errorCallback);
- */
-ImageArray.prototype.getImageToBase64 = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getBase64ImageWithId,
-		[parameters]
-	);
-};
-
-/// To remove all the images  in the ImageArray.
-/**
- * Method to remove all the KEDImages in the Image Array. After this operation none of the images will be accessed with any
- * reference.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Array} imageIDs - list if image IDs you would like to remove
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.removeImages(successCallback,errorCallback,["ImageID1","ImageID2"]);
- */
-ImageArray.prototype.removeImages = function (successCallback, errorCallback, imageIDs) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.removeImages,
-		[imageIDs]
-	);
-};
-
-/// To remove all the images at a time in the ImageArray.
-/**
- * Method to remove all the KEDImages at a time in the Image Array. After this operation none of the images will be accessed with any
- * reference.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.removeAllImages(successCallback,errorCallback);
- */
-ImageArray.prototype.removeAllImages = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.removeAllImages,
-		[]
-	);
-};
-
-/// To write the image to the disk.
-/**
- * Method to write the KEDImages to a disk. SpecifyFilePath and imageWriteToFile methods of KEDImage are used here.
- *
- * @param successCB: Default Success call back function name
- * @param errorCB: Default Error call back function name
- * @param parameters - image Id you would like to write and File Path where you want to write.
- *
- * @param {String} [parameters.imageID] image id you would like to write
- *
- * @param {String} [parameters.filePath] filepath where you want to write. The filepath needs to include imageName with extension(ex:imageName.png).
- * In iOS, it is not required to pass the documents directory path because internally MobileSDK is getting the documents directory path and appending the file path which is coming from the user.
- * In Android, if we pass imageName with extension then the image will write to phone internal storage. If we pass SD card full path (ex:/storage/emulated/0/imageName.png) then the image will write to SD card.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.imageWriteToFile(successCallback,errorCallback,{
- *   imageID:"imageID value",
- *   filePath:"imageName.png"
- * });
- */
-ImageArray.prototype.imageWriteToFile = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.imageWriteToFile,
-		[parameters]
-	);
-};
-
-/// To get the image bit map from the file.
-/**
- * Method to get the image bitmap of the KEDImage from disk. imageReadFromFile method of KEDImage is used here.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} imageID - image Id you would like to read.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.imageReadFromFile(successCallback,errorCallback,"imageID");
- */
-ImageArray.prototype.imageReadFromFile = function (successCallback, errorCallback, imageID) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.imageReadFromFile,
-		[imageID]
-	);
-};
-
-/// To clear image bitmap of KEDImage.
-/**
- * Method to clear the image bitmap of the KEDImage. clearImageBitmap method of KEDImage is used here.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} imageID - image Id you would like to clear the image bitmap.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.clearImageBitmap(successCallback,errorCallback,"imageID");
- */
-ImageArray.prototype.clearImageBitmap = function (successCallback, errorCallback, imageID) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.clearImageBitMap,
-		[imageID]
-	);
-};
-
-/// To delete the image from disk.
-/**
- * Method to delete the image from disk. deleteFile method of KEDImage is used here.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} imageID - image Id you would like to delete from disk.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.deleteFileFromDisk(successCallback,errorCallback,"imageID");
- */
-ImageArray.prototype.deleteFileFromDisk = function (successCallback, errorCallback, imageID) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.deleteFileFromDisk,
-		[imageID]
-	);
-};
-
-/// To set properties of the KedImage class .
-/**
- * Method to set the properties of the native Image class.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} parameters -  An 'ImageObject'  variable containing the properties  to be set to the Image object. The image is uniquely identified by its 'id' property.
- *
- * @param {String} [parameters.imageID] image object is identified by using this property
- *
- * @param {String} [parameters.mimeType] what mime type you want to set for an image. MIMETYPE_JPG or MIMETYPE_PNG or MIMETYPE_TIF
- *
- * @param {Number} [parameters.dpi] how much dpi you want to set for an image
- *
- * @param {Number} [parameters.tag] what tag you want to set for an image
- *
- * @param {String} [parameters.filePath] filepath where you want to write or read the image. The filepath needs to include imageName with extension(ex:imageName.png).
- * In iOS, it is not required to pass the documents directory path because internally MobileSDK is getting the documents directory path and appending the file path which is coming from the user.
- * In Android, if we pass imageName with extension then the image will write to phone internal storage. If we pass SD card full path (ex:/storage/emulated/0/imageName.png) then the image will write to SD card.
- *
- * @param {Number} [parameters.jpegQuality] hou much jpeg quality you want to set for an image. this property is applied when user write the image into a specific filepath
- *
- * @param {String} [parameters.createDateTime] what time and date you want to set for an image. you have to give ISO 8601 date format string.
- *
- * @return
- * The return value is captured in the 'successCB' for a successful operation, and might return in 'errorCB' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCB :  KMC_SUCCESS success call back.
- * errorCB :    Error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCB' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageObj =  kfxCordova.kfxEngine.createImageObject();
- * //Set the properties for the image object
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.setImageProperties(successCallback,errorCallback,{
- *        imageID: "Give imageID Here",
- *        mimeType: "MIMETYPE_JPG",
- *        dpi: 75,
- *        tag: 1,
- *        filePath: "imageName.png",
- *        createDateTime: "Give ISO 8601 Date Format String Here",
- *        jpegQuality: 75
- * });
- */
-ImageArray.prototype.setImageProperties = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.setImagePropertiesWithId,
-		[parameters]
-	);
-};
-
-/// To get properties of the KedImage class .
-/**
- * Method to get the default properties
- *
- * @example
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * var imageProperties = imageArray.imageProperties();
- * imageProperties should be like below {
- *        imageID: "",
- *        filePath:"",
- *        mimeType:"",
- *        bitmapScaling:0,
- *        tag:"",
- *        createDateTime:"",
- *        dpi:0,
- *        jpegQuality:0
- *    };
- */
-ImageArray.prototype.imageProperties = function () {
-	var imageProperties = {
-		imageID: "",
-		filePath: "",
-		mimeType: "",
-		bitmapScaling: 0,
-		tag: "",
-		createDateTime: "",
-		dpi: 0,
-		jpegQuality: 0,
-	};
-	return imageProperties;
-};
-
-/// To get the image size of an image.
-/**
- * Method to get the image size for an Image.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {String} imageID - image Id you would like to get the size.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
- *
- * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
- * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var imageArray = kfxCordova.kfxEngine.createImageArray();
- * imageArray.getImageSize(successCallback,errorCallback,"imageID");
- */
-
-ImageArray.prototype.getImageSize = function (successCallback, errorCallback, imageID) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.getImageSize,
-		[imageID]
-	);
-};
-
-//End of ImageArray methods
-module.exports = ImageArray;
+//
+// ImageArray.js
+//
+//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var base64 = require("cordova/base64");
+var ActionUtils = require("./ActionUtils");
+var PromiseUtils = require("./PromiseUtils");
+var ImageObject = require("./ImageObject");
+var HandleRegistry = require("./HandleRegistry");
+
+/// An User defined  class  to handle the image conversion operation.
+/**
+ * This class is defined to handle the Image related operations. As native SDK expected inputs for all of the classes as KEDImages,
+ * we had to define a mechanism to convert the Images to KEDImages and also to show a preview we need a format that can understood
+ * by the top level (HTML) code. This class defines methods to convert image from base64 string to KEDImage, vice versa and other
+ * supporting methods.
+ *
+ * The Image Array class maintains the Array of image objects and indexing on the image id of the KEDImage. When a base64 is sent
+ * as input, a KEDImage is created and the imageid along with the KEDImage is added to the ImageArray class.
+ *
+ * For retrieving the KEDImage, please provide the imageid as input.
+ *
+ * Due to memory constraints, there is limitation on the number of Images that can be stored on the ImageArray object.
+ * Limiting to 3/4 images is advised. This is a singleton class in native. Listed below are the plugin js methods to access the
+ * methods of the ImageArray class.
+ *
+ * @class
+ * @alias ImageArray
+ * @constructor
+ */
+//ImageArray constructor and corresponding methods
+var ImageArray = function () {};
+
+// Binary transfer settings, shared by all ImageArray instances as the native ImageArray is a singleton
+var binaryTransferOptions = {
+	chunkThreshold: 4 * 1024 * 1024,
+	chunkSize: 1024 * 1024,
+};
+var binaryTransferCounter = 0;
+
+/// To get the total number of images  stored in ImageArray.
+/**
+ * Method to get the number of images  stored in the ImageArray
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have the count of the total images stored in the ImageArray.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a string giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getTotalImages(successCallback,errorCallback);
+ */
+ImageArray.prototype.getTotalImages = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getTotalImages,
+		[]
+	);
+};
+/// To get the raw binary data buffer of the KEDImage.
+/**
+ * Method to get the raw binary data buffer of the KEDImage.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - image ID you would like to get the bytes array
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have ArrayBuffer of the image i.e byte[] of image.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong ImageID, Blob conversion failed, KmcRuntimeException & Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageAsBlob(successCallback,errorCallback,"imageID");
+ */
+ImageArray.prototype.getImageAsBlob = function (successCallback, errorCallback, imageID) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getImageAsBlob,
+		[imageID]
+	);
+};
+
+/// To get the ids of the  images stored in ImageArray.
+/**
+ * Method to get the image IDs of the images stored in ImageArray
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have the array of the Imageids from the image array.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageIDs(successCallback,errorCallback);
+ */
+ImageArray.prototype.getImageIDs = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			HandleRegistry.pin("image", result);
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getImageIds,
+		[]
+	);
+};
+
+/// To get the properties of an image  in ImageArray.
+/**
+ * Method to get the properties of an image in ImageArray.
+ *
+ * This method would get all the properties of an image which is stored in the ImageArray.
+ * This would take the imageID as the input and send back all the properties of that image in the success call back, if that exists. Otherwise,
+ * it would call the error call back method
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} ImageID - ID of the image of which you want to get the properties.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have the the properties of the 'Image' object in the form of JSON.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageProperties(successCallback,errorCallback,"ImageID");
+ */
+ImageArray.prototype.getImageProperties = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getImagePropertiesWithId,
+		[parameters]
+	);
+};
+
+/// To convert a base64 string (of an image) to KEDImage
+/**
+ * Method to convert an image in the form of base64string to a KEDImage. The KEDImage is stored in the ImageArray and the
+ * corresponding id is returned in the call back.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} base64String - an input image in the form of base64 string to be converted to KEDImage
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have the image id of the converted KEDImage(from input base64 string).
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageFromBase64(successCallback,errorCallback, 'base64string');
+ */
+ImageArray.prototype.getImageFromBase64 = function (successCallback, errorCallback, base64String) {
+	ActionUtils.exec(
+		function (result) {
+			var imgObject = new ImageObject(result);
+			if (successCallback) successCallback(imgObject);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getImageFromBase64,
+		[base64String]
+	);
+};
+
+/// To convert raw image bytes (ArrayBuffer) to KEDImage
+/**
+ * Method to create a KEDImage from the encoded bytes of an image (JPEG, PNG or TIFF) held in an ArrayBuffer, such as the result of
+ * a fetch or a FileReader, without converting it to base64 first. The KEDImage is stored in the ImageArray and returned in the call
+ * back. Note that cordova/exec itself base64-encodes ArrayBuffer arguments on both iOS and Android, so the bytes crossing the bridge
+ * are the same as for getImageFromBase64.
+ *
+ * Buffers larger than the chunk threshold (see setBinaryTransferOptions) are sent as a sequence of fixed-size chunks, one at a time,
+ * so that the bridge never holds more than one encoded chunk of the image in flight.
+ *
+ * The kedGetImageFromArrayBuffer and kedAppendImageChunk actions need a newer native kfxPlugin. With the native layer shipped in
+ * lib/, the buffer is encoded with cordova/base64 and converted through getImageFromBase64, in a single call.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {ArrayBuffer} arrayBuffer - encoded image bytes to be converted to KEDImage
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have the ImageObject of the converted KEDImage.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageFromArrayBuffer(successCallback,errorCallback, arrayBuffer);
+ */
+ImageArray.prototype.getImageFromArrayBuffer = function (successCallback, errorCallback, arrayBuffer) {
+	var onSuccess = function (result) {
+		var imgObject = new ImageObject(result);
+		if (successCallback) successCallback(imgObject);
+	};
+	var onError = function (error) {
+		if (errorCallback) errorCallback(error);
+	};
+	var fromBase64 = function () {
+		ActionUtils.exec(
+			onSuccess,
+			onError,
+			ActionUtils.serviceName,
+			ActionUtils.getImageFromBase64,
+			[base64.fromArrayBuffer(arrayBuffer)]
+		);
+	};
+	if (arrayBuffer.byteLength <= binaryTransferOptions.chunkThreshold) {
+		ActionUtils.execExtended(
+			onSuccess,
+			onError,
+			ActionUtils.serviceName,
+			ActionUtils.getImageFromArrayBuffer,
+			[arrayBuffer],
+			fromBase64
+		);
+		return;
+	}
+	var transferID = "transfer" + ++binaryTransferCounter;
+	var totalLength = arrayBuffer.byteLength;
+	var chunkSize = binaryTransferOptions.chunkSize;
+	var sendChunk = function (offset) {
+		var end = Math.min(offset + chunkSize, totalLength);
+		var last = end === totalLength;
+		ActionUtils.execExtended(
+			function (result) {
+				if (last) {
+					onSuccess(result);
+				} else {
+					sendChunk(end);
+				}
+			},
+			onError,
+			ActionUtils.serviceName,
+			ActionUtils.appendImageChunk,
+			[
+				{ transferID: transferID, offset: offset, totalLength: totalLength, last: last },
+				arrayBuffer.slice(offset, end),
+			],
+			offset === 0 ? fromBase64 : undefined
+		);
+	};
+	sendChunk(0);
+};
+
+/// To read the raw bytes of a KEDImage in chunks
+/**
+ * Method to read the encoded bytes of a KEDImage in the ImageArray as a sequence of ArrayBuffer chunks. Use this instead of
+ * getImageAsBlob for large captures, so that the whole image never has to cross the bridge in a single message.
+ *
+ * The kedGetImageChunk action needs a newer native kfxPlugin. With the native layer shipped in lib/, the image is read with
+ * getImageAsBlob in a single message and then handed to chunkCallback in chunks.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - ID of the image to read
+ * @param {Function} chunkCallback - called as chunkCallback(chunk, offset) for every ArrayBuffer chunk, in order
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  called with the total number of bytes read, after the last chunk has been delivered.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong ImageID,KmcRuntimeException,Exception.
+ *
+ * @example
+ * var chunks = [];
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageAsBlobChunks(function(totalLength){
+ *       var blob = new Blob(chunks, {type: "image/jpeg"});
+ * },function(error){
+ *       alert(JSON.stringify(error));
+ * },"imageID",function(chunk, offset){
+ *       chunks.push(chunk);
+ * });
+ */
+ImageArray.prototype.getImageAsBlobChunks = function (successCallback, errorCallback, imageID, chunkCallback) {
+	var chunkSize = binaryTransferOptions.chunkSize;
+	var onError = function (error) {
+		if (errorCallback) errorCallback(error);
+	};
+	var readWhole = function () {
+		ActionUtils.exec(
+			function (buffer) {
+				var totalLength = buffer ? buffer.byteLength : 0;
+				for (var offset = 0; offset < totalLength && chunkCallback; offset += chunkSize) {
+					chunkCallback(buffer.slice(offset, Math.min(offset + chunkSize, totalLength)), offset);
+				}
+				if (successCallback) successCallback(totalLength);
+			},
+			onError,
+			ActionUtils.serviceName,
+			ActionUtils.getImageAsBlob,
+			[imageID]
+		);
+	};
+	var readChunk = function (offset) {
+		ActionUtils.execExtended(
+			function (chunk) {
+				var length = chunk ? chunk.byteLength : 0;
+				if (length > 0 && chunkCallback) chunkCallback(chunk, offset);
+				if (length < chunkSize) {
+					if (successCallback) successCallback(offset + length);
+				} else {
+					readChunk(offset + length);
+				}
+			},
+			onError,
+			ActionUtils.serviceName,
+			ActionUtils.getImageChunk,
+			[{ imageID: imageID, offset: offset, length: chunkSize }],
+			offset === 0 ? readWhole : undefined
+		);
+	};
+	readChunk(0);
+};
+
+/// To configure binary image transfers
+/**
+ * Method to configure how getImageFromArrayBuffer and getImageAsBlobChunks move image bytes across the bridge.
+ *
+ * @param {Object} parameters - A JSON object with the transfer options
+ * @param {Number} [parameters.chunkThreshold = 4194304] - images up to this many bytes are sent in a single call, larger ones are chunked
+ * @param {Number} [parameters.chunkSize = 1048576] - size in bytes of each chunk
+ *
+ * @example
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.setBinaryTransferOptions({chunkThreshold: 2097152, chunkSize: 524288});
+ */
+ImageArray.prototype.setBinaryTransferOptions = function (parameters) {
+	if (parameters.chunkThreshold > 0) binaryTransferOptions.chunkThreshold = parameters.chunkThreshold;
+	if (parameters.chunkSize > 0) binaryTransferOptions.chunkSize = parameters.chunkSize;
+};
+
+/// To create a KEDImage from a specified file location
+/**
+ * Method to create and store a KEDImage in the ImageArray. The KEDImage is created from the image specified in the input
+ * file location.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} filePath - String variable representing a physical location of an image which need to be converted to a KEDImage
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have the image id of the converted KEDImage(from input image mentioned in the file path )
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageFromFilePath(successCallback,errorCallback, 'filepath of any image');
+ */
+ImageArray.prototype.getImageFromFilePath = function (successCallback, errorCallback, filePath) {
+	ActionUtils.exec(
+		function (result) {
+			var imgObject = new ImageObject(result);
+			if (successCallback) successCallback(imgObject);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getImageFromFilepath,
+		[filePath]
+	);
+};
+
+/// To get the base64 string (of an image) from a KEDImage in the ImageArray
+/**
+ * Method to get a base64 string of KEDImage which is already present in the ImageArray. If no KEDImage is found fro the
+ * provided input image id, error will be returned
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} ImageID - ID of the image of which you want to get the base64 string.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back will have the base64 string of the input image id.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageToBase64(successCallback,errorCallback);
+ */
+ImageArray.prototype.getImageToBase64 = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getBase64ImageWithId,
+		[parameters]
+	);
+};
+
+/// To remove all the images  in the ImageArray.
+/**
+ * Method to remove all the KEDImages in the Image Array. After this operation none of the images will be accessed with any
+ * reference.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Array} imageIDs - list if image IDs you would like to remove
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.removeImages(successCallback,errorCallback,["ImageID1","ImageID2"]);
+ */
+ImageArray.prototype.removeImages = function (successCallback, errorCallback, imageIDs) {
+	ActionUtils.exec(
+		function (result) {
+			HandleRegistry.forget("image", imageIDs);
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.removeImages,
+		[imageIDs]
+	);
+};
+
+/// To remove all the images at a time in the ImageArray.
+/**
+ * Method to remove all the KEDImages at a time in the Image Array. After this operation none of the images will be accessed with any
+ * reference.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.removeAllImages(successCallback,errorCallback);
+ */
+ImageArray.prototype.removeAllImages = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			HandleRegistry.forget("image");
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.removeAllImages,
+		[]
+	);
+};
+
+var outputMimeTypes = { JPEG: "MIMETYPE_JPEG", PNG: "MIMETYPE_PNG", TIFF_G4: "MIMETYPE_TIFF" };
+
+// Writes the outputs of imageWriteToFile, in one kedImageWriteToFiles call or one kedImageWriteToFile call each
+function writeOutputs(successCallback, errorCallback, imageID, outputs) {
+	var call = function (action, args, success, error) {
+		ActionUtils.exec(success, error, ActionUtils.serviceName, action, args);
+	};
+	var fail = function (error) {
+		if (errorCallback) errorCallback(error);
+	};
+	// Sets the format, jpegQuality and dpi of each output on the image before writing it, then restores the image properties
+	var writeAll = function (image) {
+		var saved = { imageID: imageID, mimeType: image.mimeType, dpi: image.dpi, jpegQuality: image.jpegQuality };
+		var results = [];
+		var restoreThen = function (done) {
+			return function (result) {
+				var finish = function () {
+					done(result);
+				};
+				call(ActionUtils.setImagePropertiesWithId, [saved], finish, finish);
+			};
+		};
+		var next = function () {
+			var output = outputs[results.length];
+			if (!output) {
+				restoreThen(function () {
+					if (successCallback) successCallback(results);
+				})();
+				return;
+			}
+			var properties = {
+				imageID: imageID,
+				mimeType: outputMimeTypes[output.format] || saved.mimeType,
+				dpi: output.dpi !== undefined ? output.dpi : saved.dpi,
+				jpegQuality: output.jpegQuality !== undefined ? output.jpegQuality : saved.jpegQuality,
+			};
+			var written = function () {
+				results.push({ filePath: output.filePath });
+				next();
+			};
+			var write = function () {
+				var file = { imageID: imageID, filePath: output.filePath };
+				call(ActionUtils.imageWriteToFile, [file], written, restoreThen(fail));
+			};
+			call(ActionUtils.setImagePropertiesWithId, [properties], write, restoreThen(fail));
+		};
+		next();
+	};
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		fail,
+		ActionUtils.serviceName,
+		ActionUtils.imageWriteToFiles,
+		[{ imageID: imageID, outputs: outputs }],
+		function () {
+			call(ActionUtils.getImagePropertiesWithId, [imageID], writeAll, fail);
+		}
+	);
+}
+
+/// To write the image to the disk.
+/**
+ * Method to write the KEDImages to a disk. SpecifyFilePath and imageWriteToFile methods of KEDImage are used here.
+ *
+ * @param successCB: Default Success call back function name
+ * @param errorCB: Default Error call back function name
+ * @param parameters - image Id you would like to write and File Path where you want to write.
+ *
+ * @param {String} [parameters.imageID] image id you would like to write
+ *
+ * @param {String} [parameters.filePath] filepath where you want to write. The filepath needs to include imageName with extension(ex:imageName.png).
+ * In iOS, it is not required to pass the documents directory path because internally MobileSDK is getting the documents directory path and appending the file path which is coming from the user.
+ * In Android, if we pass imageName with extension then the image will write to phone internal storage. If we pass SD card full path (ex:/storage/emulated/0/imageName.png) then the image will write to SD card.
+ *
+ * @param {Array} [parameters.outputs] list of output specifications, used instead of filePath to write several variants of the image in one call,
+ * such as the full resolution JPEG, a review thumbnail and a downscaled copy for extraction. Each output is a JSON object with the following properties:
+ * filePath - path of the file, following the same rules as parameters.filePath.
+ * format - "JPEG", "PNG" or "TIFF_G4". Defaults to the mime type of the image.
+ * maxDimension - the larger side of the output in pixels, keeping the aspect ratio. Defaults to the image size; images are never upscaled.
+ * jpegQuality - JPEG quality from 1 to 100. Defaults to the jpegQuality of the image.
+ * dpi - resolution written in the file header. Defaults to the dpi of the image.
+ *
+ * The outputs go to the kedImageWriteToFiles action, which needs a newer native kfxPlugin than the one shipped in lib/: the image is decoded
+ * once, every variant is resampled from the decoded bitmap and the files are encoded and written in parallel. On a native layer without it,
+ * each output is written by its own kedImageWriteToFile call, with its format, jpegQuality and dpi set on the image first and the image
+ * properties restored afterwards; maxDimension is not applied there and every output is written at the size of the image.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back. With parameters.outputs, an array of {filePath, width, height, fileSize} in the order of the
+ * outputs; on a native layer without kedImageWriteToFiles the entries only have filePath.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters,KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.imageWriteToFile(successCallback,errorCallback,{
+ *   imageID:"imageID value",
+ *   filePath:"imageName.png"
+ * });
+ * imageArray.imageWriteToFile(successCallback,errorCallback,{
+ *   imageID:"imageID value",
+ *   outputs:[
+ *     {filePath:"page1.jpg", jpegQuality:90},
+ *     {filePath:"page1_thumbnail.jpg", maxDimension:256, jpegQuality:70},
+ *     {filePath:"page1_extraction.tif", format:"TIFF_G4", maxDimension:2000, dpi:200}
+ *   ]
+ * });
+ */
+ImageArray.prototype.imageWriteToFile = function (successCallback, errorCallback, parameters) {
+	if (parameters && parameters.outputs) {
+		writeOutputs(successCallback, errorCallback, parameters.imageID, parameters.outputs);
+		return;
+	}
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.imageWriteToFile,
+		[parameters]
+	);
+};
+
+/// To get the image bit map from the file.
+/**
+ * Method to get the image bitmap of the KEDImage from disk. imageReadFromFile method of KEDImage is used here.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - image Id you would like to read.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.imageReadFromFile(successCallback,errorCallback,"imageID");
+ */
+ImageArray.prototype.imageReadFromFile = function (successCallback, errorCallback, imageID) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.imageReadFromFile,
+		[imageID]
+	);
+};
+
+/// To clear image bitmap of KEDImage.
+/**
+ * Method to clear the image bitmap of the KEDImage. clearImageBitmap method of KEDImage is used here.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - image Id you would like to clear the image bitmap.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.clearImageBitmap(successCallback,errorCallback,"imageID");
+ */
+ImageArray.prototype.clearImageBitmap = function (successCallback, errorCallback, imageID) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.clearImageBitMap,
+		[imageID]
+	);
+};
+
+/// To delete the image from disk.
+/**
+ * Method to delete the image from disk. deleteFile method of KEDImage is used here.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - image Id you would like to delete from disk.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.deleteFileFromDisk(successCallback,errorCallback,"imageID");
+ */
+ImageArray.prototype.deleteFileFromDisk = function (successCallback, errorCallback, imageID) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.deleteFileFromDisk,
+		[imageID]
+	);
+};
+
+/// To set properties of the KedImage class .
+/**
+ * Method to set the properties of the native Image class.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters -  An 'ImageObject'  variable containing the properties  to be set to the Image object. The image is uniquely identified by its 'id' property.
+ *
+ * @param {String} [parameters.imageID] image object is identified by using this property
+ *
+ * @param {String} [parameters.mimeType] what mime type you want to set for an image. MIMETYPE_JPG or MIMETYPE_PNG or MIMETYPE_TIF
+ *
+ * @param {Number} [parameters.dpi] how much dpi you want to set for an image
+ *
+ * @param {Number} [parameters.tag] what tag you want to set for an image
+ *
+ * @param {String} [parameters.filePath] filepath where you want to write or read the image. The filepath needs to include imageName with extension(ex:imageName.png).
+ * In iOS, it is not required to pass the documents directory path because internally MobileSDK is getting the documents directory path and appending the file path which is coming from the user.
+ * In Android, if we pass imageName with extension then the image will write to phone internal storage. If we pass SD card full path (ex:/storage/emulated/0/imageName.png) then the image will write to SD card.
+ *
+ * @param {Number} [parameters.jpegQuality] hou much jpeg quality you want to set for an image. this property is applied when user write the image into a specific filepath
+ *
+ * @param {String} [parameters.createDateTime] what time and date you want to set for an image. you have to give ISO 8601 date format string.
+ *
+ * @return
+ * The return value is captured in the 'successCB' for a successful operation, and might return in 'errorCB' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCB :  KMC_SUCCESS success call back.
+ * errorCB :    Error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCB' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with ErrorMsg & ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageObj =  kfxCordova.kfxEngine.createImageObject();
+ * //Set the properties for the image object
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.setImageProperties(successCallback,errorCallback,{
+ *        imageID: "Give imageID Here",
+ *        mimeType: "MIMETYPE_JPG",
+ *        dpi: 75,
+ *        tag: 1,
+ *        filePath: "imageName.png",
+ *        createDateTime: "Give ISO 8601 Date Format String Here",
+ *        jpegQuality: 75
+ * });
+ */
+ImageArray.prototype.setImageProperties = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.setImagePropertiesWithId,
+		[parameters]
+	);
+};
+
+/// To get properties of the KedImage class .
+/**
+ * Method to get the default properties
+ *
+ * @example
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * var imageProperties = imageArray.imageProperties();
+ * imageProperties should be like below {
+ *        imageID: "",
+ *        filePath:"",
+ *        mimeType:"",
+ *        bitmapScaling:0,
+ *        tag:"",
+ *        createDateTime:"",
+ *        dpi:0,
+ *        jpegQuality:0
+ *    };
+ */
+ImageArray.prototype.imageProperties = function () {
+	var imageProperties = {
+		imageID: "",
+		filePath: "",
+		mimeType: "",
+		bitmapScaling: 0,
+		tag: "",
+		createDateTime: "",
+		dpi: 0,
+		jpegQuality: 0,
+	};
+	return imageProperties;
+};
+
+/// To get the image size of an image.
+/**
+ * Method to get the image size for an Image.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - image Id you would like to get the size.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
+ *
+ * @see Check the 'errorCallback' method for any failures in case of unexpected behaviour of the method. Generally the error call back
+ * would return a JSON object with 'ErrorMsg' & 'ErrorDesc' giving the description of the error.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageSize(successCallback,errorCallback,"imageID");
+ */
+
+ImageArray.prototype.getImageSize = function (successCallback, errorCallback, imageID) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getImageSize,
+		[imageID]
+	);
+};
+
+/// To configure the bitmap cache of the ImageArray.
+/**
+ * Method to enable and configure the budgeted bitmap cache. When enabled, the native ImageArray keeps the decoded bitmaps of its
+ * images under the given byte ceiling. When the ceiling is exceeded, the least recently used bitmaps are written to their filePath
+ * (if not written already) and released. An evicted image is reloaded from its file transparently the next time it is accessed
+ * by any method, so image IDs stay valid.
+ *
+ * Pinned images are never evicted. The image currently set on an ImageReviewControl with setImage is pinned automatically until
+ * another image is set or clearImage is called.
+ *
+ * The cache methods need a newer native kfxPlugin than the one shipped in lib/. On a native layer without them, the errorCallback
+ * of setImageCacheOptions, getImageCacheStats, pinImage and unpinImage gets {ErrorMsg: "Invalid action", ErrorDesc} and images
+ * stay in memory as before.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - A JSON object with the cache options
+ * @param {Boolean} [parameters.enabled = false] - enables or disables the budgeted cache. Disabling it reloads nothing, evicted images are reloaded on access as before.
+ * @param {Number} [parameters.maxBytes] - ceiling in bytes for the decoded bitmaps kept in memory
+ * @param {String} [parameters.evictionDirectory] - directory used for evicted images which have no filePath yet. Defaults to the application cache directory.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
+ *
+ * @example
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.setImageCacheOptions(successCallback,errorCallback,{enabled: true, maxBytes: 150 * 1024 * 1024});
+ */
+ImageArray.prototype.setImageCacheOptions = function (successCallback, errorCallback, parameters) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.setImageCacheOptions,
+		[parameters]
+	);
+};
+
+/// To get the statistics of the bitmap cache.
+/**
+ * Method to get the counters of the budgeted bitmap cache since it was enabled.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  a JSON object {hits, misses, evictions, residentBytes, maxBytes, residentImages, pinnedImages}.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.getImageCacheStats(function(stats){
+ *       alert(stats.hits + " hits, " + stats.evictions + " evictions");
+ * },errorCallback);
+ */
+ImageArray.prototype.getImageCacheStats = function (successCallback, errorCallback) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.getImageCacheStats,
+		[]
+	);
+};
+
+/// To pin an image in memory.
+/**
+ * Method to keep the bitmap of an image in memory regardless of the cache ceiling, until unpinImage is called.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - image Id you would like to pin.
+ *
+ * @example
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.pinImage(successCallback,errorCallback,"imageID");
+ */
+ImageArray.prototype.pinImage = function (successCallback, errorCallback, imageID) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.pinImage,
+		[imageID]
+	);
+};
+
+/// To unpin an image.
+/**
+ * Method to make a pinned image eligible for eviction again.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {String} imageID - image Id you would like to unpin.
+ *
+ * @example
+ * var imageArray = kfxCordova.kfxEngine.createImageArray();
+ * imageArray.unpinImage(successCallback,errorCallback,"imageID");
+ */
+ImageArray.prototype.unpinImage = function (successCallback, errorCallback, imageID) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.unpinImage,
+		[imageID]
+	);
+};
+
+//End of ImageArray methods
+
+// Methods taking (successCallback, errorCallback, ...), for PromiseUtils.promisify
+PromiseUtils.registerCallbackMethods(ImageArray, [
+	"getTotalImages",
+	"getImageAsBlob",
+	"getImageIDs",
+	"getImageProperties",
+	"getImageFromBase64",
+	"getImageFromArrayBuffer",
+	"getImageAsBlobChunks",
+	"getImageFromFilePath",
+	"getImageToBase64",
+	"removeImages",
+	"removeAllImages",
+	"imageWriteToFile",
+	"imageReadFromFile",
+	"clearImageBitmap",
+	"deleteFileFromDisk",
+	"setImageProperties",
+	"getImageSize",
+	"setImageCacheOptions",
+	"getImageCacheStats",
+	"pinImage",
+	"unpinImage",
+]);
+
+module.exports = ImageArray;
@@ -0,0 +1,373 @@
+//
+// ImageProcessingQueue.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+var PromiseUtils = require("./PromiseUtils");
+var ImageObject = require("./ImageObject");
+var ImageProcessor = require("./ImageProcessor");
+
+var queueCounter = 0;
+
+/// A queue which processes many images in parallel on a bounded native worker pool
+/**
+ * ImageProcessor.processImage handles one image at a time and reports the result through the single imageOut listener.
+ * The ImageProcessingQueue accepts any number of image processing jobs, each with its own image processing options and priority,
+ * and hands them to a native worker pool of configurable size through the kenProcessImageBatch action. Each result is
+ * delivered to the callbacks of its own job, tagged with the job ID, so there is no need to correlate imageOut events.
+ *
+ * Jobs added in the same JavaScript turn are sent to native together in priority order. Higher priority jobs are started first;
+ * jobs with the same priority are started in the order they were added.
+ *
+ * kenProcessImageBatch needs a newer native kfxPlugin than the one shipped in lib/. On a native layer without it the jobs run one
+ * at a time through the ImageProcessor actions, with the same priority order. The queue then borrows the single native imageOut
+ * listener and the image processor options while it has jobs, so the app should not process images through an ImageProcessor at
+ * the same time. Once the queue is empty, the imageOut listener the app added through ImageProcessor.addImageOutEventListener and
+ * the options it had set are put back.
+ *
+ * @class
+ * @alias ImageProcessingQueue
+ * @constructor
+ * @param {Object} [parameters] - A JSON object with the queue options
+ * @param {Number} [parameters.concurrency = 2] - maximum number of images processed at the same time
+ */
+var ImageProcessingQueue = function (parameters) {
+	this.queueID = "imageProcessingQueue" + ++queueCounter;
+	this.concurrency = (parameters && parameters.concurrency) || 2;
+	this.pendingJobs = [];
+	this.activeJobs = {};
+	this.jobCounter = 0;
+	this.flushScheduled = false;
+	// Jobs waiting for the ImageProcessor, on a native layer without kenProcessImageBatch
+	this.serialJobs = [];
+	this.runningJob = null;
+	this.imageOutRegistered = false;
+	// Image processor options of the app, saved before the first job with its own options, or undefined
+	this.appOptions = undefined;
+};
+
+function byPriority(a, b) {
+	return b.priority - a.priority || a.sequence - b.sequence;
+}
+
+function userAbort(job) {
+	return {
+		jobID: job.jobID,
+		error: { ErrorMsg: "KMC_EV_USER_ABORT", ErrorDesc: "The job was cancelled before it completed" },
+	};
+}
+
+/// To add an image processing job to the queue.
+/**
+ * Adds an image to the queue. The job is sent to native at the end of the current JavaScript turn.
+ *
+ * @param {Function} successCallback - called with {jobID, image} when the job completes, where image is the processed ImageObject
+ * @param {Function} errorCallback - called with {jobID, error} when the job fails or is cancelled
+ * @param {Object} parameters - A JSON object describing the job
+ * @param {String} parameters.imageID - ID of the input image in the ImageArray
+ * @param {Object} [parameters.imageProcessingOptions] - options for this job, as returned by ImageProcessor.getImageProcessingOptions(). When omitted the options last set on the ImageProcessor are used.
+ * @param {Number} [parameters.priority = 0] - jobs with a higher priority are started first
+ *
+ * @return The ID of the job, which is also included in the results.
+ *
+ * @example
+ * var queue = kfxCordova.kfxEngine.createImageProcessingQueue({concurrency: 4});
+ * var options = kfxCordova.kfxEngine.createImageProcessor().getImageProcessingOptions();
+ * imageIDs.forEach(function(imageID){
+ *       queue.addJob(function(result){
+ *             alert(result.jobID + " " + result.image.imgID);
+ *       },function(error){
+ *             alert(JSON.stringify(error));
+ *       },{imageID: imageID, imageProcessingOptions: options});
+ * });
+ */
+ImageProcessingQueue.prototype.addJob = function (successCallback, errorCallback, parameters) {
+	var jobID = this.queueID + "_job" + ++this.jobCounter;
+	this.pendingJobs.push({
+		jobID: jobID,
+		sequence: this.jobCounter,
+		imageID: parameters.imageID,
+		imageProcessingOptions: parameters.imageProcessingOptions,
+		priority: parameters.priority || 0,
+		successCallback: successCallback,
+		errorCallback: errorCallback,
+	});
+	this.scheduleFlush();
+	return jobID;
+};
+
+ImageProcessingQueue.prototype.scheduleFlush = function () {
+	if (this.flushScheduled) return;
+	this.flushScheduled = true;
+	var self = this;
+	Promise.resolve().then(function () {
+		self.flushScheduled = false;
+		self.flush();
+	});
+};
+
+// Sends all pending jobs to the native worker pool in one kenProcessImageBatch call
+ImageProcessingQueue.prototype.flush = function () {
+	if (this.pendingJobs.length === 0) return;
+	var jobs = this.pendingJobs.sort(byPriority);
+	this.pendingJobs = [];
+	var self = this;
+	var batch = jobs.map(function (job) {
+		self.activeJobs[job.jobID] = job;
+		return {
+			jobID: job.jobID,
+			imageID: job.imageID,
+			imageProcessingOptions: job.imageProcessingOptions,
+			priority: job.priority,
+		};
+	});
+	ActionUtils.execExtended(
+		function (result) {
+			if (result.eventType !== "eventRaised") return;
+			var job = self.activeJobs[result.jobID];
+			if (!job) return;
+			delete self.activeJobs[result.jobID];
+			if (result.error) {
+				if (job.errorCallback) job.errorCallback({ jobID: job.jobID, error: result.error });
+			} else {
+				if (job.successCallback) job.successCallback({ jobID: job.jobID, image: new ImageObject(result.image) });
+			}
+		},
+		function (error) {
+			self.failJobs(jobs, error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.processImageBatch,
+		[{ queueID: this.queueID, concurrency: this.concurrency, jobs: batch }],
+		function () {
+			jobs.forEach(function (job) {
+				if (self.activeJobs[job.jobID]) self.serialJobs.push(job);
+			});
+			self.serialJobs.sort(byPriority);
+			self.runNextSerialJob();
+		}
+	);
+};
+
+ImageProcessingQueue.prototype.failJobs = function (jobs, error) {
+	var self = this;
+	jobs.forEach(function (job) {
+		if (!self.activeJobs[job.jobID]) return;
+		delete self.activeJobs[job.jobID];
+		if (job.errorCallback) job.errorCallback({ jobID: job.jobID, error: error });
+	});
+};
+
+// Runs the next job through kenProcessImage, for a native layer without kenProcessImageBatch
+ImageProcessingQueue.prototype.runNextSerialJob = function () {
+	if (this.runningJob) return;
+	var self = this;
+	var job = this.serialJobs.shift();
+	if (!job) {
+		this.restoreAppState();
+		return;
+	}
+	this.runningJob = job;
+	var fail = function (error) {
+		self.finishSerialJob(job, error);
+	};
+	var process = function () {
+		ActionUtils.exec(null, fail, ActionUtils.serviceName, ActionUtils.processImage, [job.imageID]);
+	};
+	var setOptions = function (options) {
+		ActionUtils.exec(process, fail, ActionUtils.serviceName, ActionUtils.setImageProcessorOptions, [options]);
+	};
+	this.registerImageOut(function () {
+		if (job.imageProcessingOptions) {
+			self.saveAppOptions(function () {
+				setOptions(job.imageProcessingOptions);
+			}, fail);
+		} else if (self.appOptions !== undefined) {
+			// A job without options runs with the options of the app, not with those of the previous job
+			setOptions(self.appOptions);
+		} else {
+			process();
+		}
+	}, fail);
+};
+
+ImageProcessingQueue.prototype.saveAppOptions = function (callback, errorCallback) {
+	if (this.appOptions !== undefined) {
+		callback();
+		return;
+	}
+	var self = this;
+	ActionUtils.exec(
+		function (options) {
+			self.appOptions = options;
+			callback();
+		},
+		errorCallback,
+		ActionUtils.serviceName,
+		ActionUtils.getImageProcessorOptions,
+		[]
+	);
+};
+
+// Gives the imageOut listener and the image processor options back to the app once the serial jobs are done
+ImageProcessingQueue.prototype.restoreAppState = function () {
+	if (this.appOptions !== undefined) {
+		ActionUtils.exec(null, null, ActionUtils.serviceName, ActionUtils.setImageProcessorOptions, [this.appOptions]);
+		this.appOptions = undefined;
+	}
+	if (!this.imageOutRegistered) return;
+	this.imageOutRegistered = false;
+	ImageProcessor.restoreImageOutListener(function (restored) {
+		if (!restored) ActionUtils.exec(null, null, ActionUtils.serviceName, ActionUtils.removeImageOutEventListener, []);
+	});
+};
+
+ImageProcessingQueue.prototype.registerImageOut = function (callback, errorCallback) {
+	if (this.imageOutRegistered) {
+		callback();
+		return;
+	}
+	var self = this;
+	ActionUtils.exec(
+		function (result) {
+			if (result.eventType === "eventRegistered") {
+				self.imageOutRegistered = true;
+				callback();
+			} else if (result.eventType === "eventRaised" && self.runningJob) {
+				self.finishSerialJob(self.runningJob, null, result);
+			}
+		},
+		function (error) {
+			if (!self.imageOutRegistered) {
+				errorCallback(error);
+			} else if (self.runningJob) {
+				self.finishSerialJob(self.runningJob, error);
+			}
+		},
+		ActionUtils.serviceName,
+		ActionUtils.addImageOutEventListener,
+		[]
+	);
+};
+
+ImageProcessingQueue.prototype.finishSerialJob = function (job, error, result) {
+	if (this.runningJob !== job) return;
+	this.runningJob = null;
+	if (this.activeJobs[job.jobID]) {
+		delete this.activeJobs[job.jobID];
+		if (error) {
+			if (job.errorCallback) job.errorCallback({ jobID: job.jobID, error: error });
+		} else {
+			if (job.successCallback) job.successCallback({ jobID: job.jobID, image: new ImageObject(result) });
+		}
+	}
+	this.runNextSerialJob();
+};
+
+/// To change the number of images processed at the same time.
+/**
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Number} concurrency - maximum number of images processed at the same time. Applies to jobs already queued in native as well.
+ * Has no effect on a native layer without kenProcessImageBatch, where jobs run one at a time.
+ *
+ * @example
+ * queue.setConcurrency(successCallback, errorCallback, 8);
+ */
+ImageProcessingQueue.prototype.setConcurrency = function (successCallback, errorCallback, concurrency) {
+	this.concurrency = concurrency;
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.setProcessImageBatchOptions,
+		[{ queueID: this.queueID, concurrency: concurrency }],
+		function () {
+			if (successCallback) successCallback("KMC_SUCCESS");
+		}
+	);
+};
+
+/// To cancel jobs in the queue.
+/**
+ * Cancels the given jobs, or every job of the queue when no job IDs are given. Jobs which have not been sent to native yet are
+ * dropped immediately; jobs already in native are cancelled and report KMC_EV_USER_ABORT through their errorCallback.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Array} [jobIDs] - IDs returned by addJob
+ *
+ * @example
+ * queue.cancelJobs(successCallback, errorCallback);
+ */
+ImageProcessingQueue.prototype.cancelJobs = function (successCallback, errorCallback, jobIDs) {
+	var all = !jobIDs;
+	var isCancelled = function (job) {
+		return all || jobIDs.indexOf(job.jobID) !== -1;
+	};
+	var self = this;
+	var drop = function (job) {
+		if (!isCancelled(job)) return true;
+		delete self.activeJobs[job.jobID];
+		if (job.errorCallback) job.errorCallback(userAbort(job));
+		return false;
+	};
+	this.pendingJobs = this.pendingJobs.filter(drop);
+	this.serialJobs = this.serialJobs.filter(drop);
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.cancelProcessImageBatch,
+		[{ queueID: this.queueID, jobIDs: all ? null : jobIDs }],
+		function () {
+			// Jobs sent while the native capabilities were unknown only reach serialJobs now
+			self.serialJobs = self.serialJobs.filter(drop);
+			var running = self.runningJob;
+			if (!running || !isCancelled(running) || !self.activeJobs[running.jobID]) {
+				if (successCallback) successCallback("KMC_SUCCESS");
+				return;
+			}
+			// The running job reports KMC_EV_USER_ABORT now; its imageOut event, if any, only starts the next job
+			delete self.activeJobs[running.jobID];
+			if (running.errorCallback) running.errorCallback(userAbort(running));
+			ActionUtils.exec(
+				function (result) {
+					if (successCallback) successCallback(result);
+				},
+				function (error) {
+					if (errorCallback) errorCallback(error);
+				},
+				ActionUtils.serviceName,
+				ActionUtils.cancelImageProcess,
+				[]
+			);
+		}
+	);
+};
+
+/// To get the number of jobs not yet completed.
+/**
+ * @return The number of jobs added to the queue which have not completed yet.
+ */
+ImageProcessingQueue.prototype.getOutstandingJobCount = function () {
+	return this.pendingJobs.length + Object.keys(this.activeJobs).length;
+};
+
+// Methods taking (successCallback, errorCallback, ...), for PromiseUtils.promisify
+PromiseUtils.registerCallbackMethods(ImageProcessingQueue, [
+	"addJob",
+	"setConcurrency",
+	"cancelJobs",
+]);
+
+module.exports = ImageProcessingQueue;
@@ -1,90 +1,366 @@
-//
-// Logging.js
-//
-//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
-
-var ActionUtils = require("./ActionUtils");
-
-//Logging constructor and corresponding methods
-/**
- * @class
- * @alias Logging
- * @constructor
- */
-var Logging = function () {};
-
-/// Enables SDK logging to console
-/**
- * Calling this method will start SDK logging to a console.
- * Logging is disabled by default.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS    if logging started successfully.
- * errorCallback -    error message would contain the error description. Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * var Logging = kfxCordova.kfxUtilities.createLogging();
- * Logging.enableMobileSDKLogging(function(enableLoggingSuccess){
- *       alert(JSON.stringify(enableLoggingSuccess));
- * },function(enableLoggingError){
- *       alert(JSON.stringify(enableLoggingError));
- * });
- */
-
-Logging.prototype.enableMobileSDKLogging = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kutEnableLogging,
-		[]
-	);
-};
-
-/// Disables SDK logging to console
-/**
- * Calling this method will stop SDK logging to a console.
- * Logging is disabled by default.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS    if logging started successfully.
- * errorCallback -    error message would contain the error description. Possible error objects are KmcRuntimeException,Exception.
- *
- * @code
- * var Logging = kfxCordova.kfxUtilities.createLogging();
- * Logging.disableMobileSDKLogging(function(disableLoggingSuccess){
- *       alert(JSON.stringify(disableLoggingSuccess));
- * },function(disableLoggingError){
- *       alert(JSON.stringify(disableLoggingError));
- * });
- */
-
-Logging.prototype.disableMobileSDKLogging = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kutDisableLogging,
-		[]
-	);
-};
-
-//End of Logging Methods
-
-module.exports = Logging;
+//
+// Logging.js
+//
+//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+var PromiseUtils = require("./PromiseUtils");
+
+// Severity order of the logging levels, from least to most verbose
+var LEVELS = ["OFF", "ERROR", "WARNING", "INFO", "DEBUG", "VERBOSE"];
+
+// Logging options mirrored from the last setLoggingOptions call, used to filter application records before they cross the bridge
+var loggingOptions = {
+	defaultLevel: "INFO",
+	moduleLevels: {},
+	sampling: {},
+	queueCapacity: 1024,
+	batchSize: 64,
+	flushInterval: 1000,
+};
+var recordQueue = [];
+// Records sent with kutWriteLogRecords and not yet acknowledged; with recordQueue they count against queueCapacity
+var recordsInFlight = 0;
+var droppedRecords = {};
+var rateWindows = {};
+var flushTimer = null;
+
+var levelRank = function (level) {
+	var rank = LEVELS.indexOf(level);
+	return rank === -1 ? LEVELS.indexOf("INFO") : rank;
+};
+
+var countDrop = function (module, reason) {
+	var counters =
+		droppedRecords[module] || (droppedRecords[module] = { overflow: 0, rateLimited: 0, sampled: 0, failed: 0 });
+	counters[reason]++;
+};
+
+// Applies the sampling rate and the per second limit configured for the module. Returns the reason when the record is dropped.
+var samplingDecision = function (module) {
+	var sampling = loggingOptions.sampling[module];
+	if (!sampling) return null;
+	if (sampling.rate !== undefined && sampling.rate < 1 && Math.random() >= sampling.rate) return "sampled";
+	if (sampling.maxPerSecond > 0) {
+		var second = Math.floor(Date.now() / 1000);
+		var rateWindow = rateWindows[module];
+		if (!rateWindow || rateWindow.second !== second) rateWindow = rateWindows[module] = { second: second, count: 0 };
+		if (++rateWindow.count > sampling.maxPerSecond) return "rateLimited";
+	}
+	return null;
+};
+
+// Writes records to the console one by one, as the application did before Logging.log, when native cannot take them
+var writeToConsole = function (records) {
+	if (typeof console === "undefined") return;
+	records.forEach(function (record) {
+		var line = new Date(record.time).toISOString() + " " + record.level + " [" + record.module + "] " + record.message;
+		var write = record.level === "ERROR" ? console.error : record.level === "WARNING" ? console.warn : console.log;
+		if (record.fields !== undefined) {
+			write.call(console, line, record.fields);
+		} else {
+			write.call(console, line);
+		}
+	});
+};
+
+// Sends the queued records with kutWriteLogRecords. Records which native does not take are written to the console instead;
+// those it fails to take are also counted as 'failed' and reported to errorCallback when given.
+var flushRecords = function (successCallback, errorCallback) {
+	if (flushTimer) {
+		clearTimeout(flushTimer);
+		flushTimer = null;
+	}
+	if (recordQueue.length === 0) {
+		if (successCallback) successCallback("KMC_SUCCESS");
+		return;
+	}
+	var records = recordQueue;
+	recordQueue = [];
+	recordsInFlight += records.length;
+	ActionUtils.execExtended(
+		function (result) {
+			recordsInFlight -= records.length;
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			recordsInFlight -= records.length;
+			records.forEach(function (record) {
+				countDrop(record.module, "failed");
+			});
+			writeToConsole(records);
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutWriteLogRecords,
+		[records],
+		function () {
+			recordsInFlight -= records.length;
+			writeToConsole(records);
+			if (successCallback) successCallback("KMC_SUCCESS");
+		}
+	);
+};
+
+//Logging constructor and corresponding methods
+/**
+ * @class
+ * @alias Logging
+ * @constructor
+ */
+var Logging = function () {};
+
+/// Enables SDK logging to console
+/**
+ * Calling this method will start SDK logging to a console.
+ * Logging is disabled by default.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS    if logging started successfully.
+ * errorCallback -    error message would contain the error description. Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * var Logging = kfxCordova.kfxUtilities.createLogging();
+ * Logging.enableMobileSDKLogging(function(enableLoggingSuccess){
+ *       alert(JSON.stringify(enableLoggingSuccess));
+ * },function(enableLoggingError){
+ *       alert(JSON.stringify(enableLoggingError));
+ * });
+ */
+
+Logging.prototype.enableMobileSDKLogging = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutEnableLogging,
+		[]
+	);
+};
+
+/// Disables SDK logging to console
+/**
+ * Calling this method will stop SDK logging to a console.
+ * Logging is disabled by default.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS    if logging started successfully.
+ * errorCallback -    error message would contain the error description. Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @code
+ * var Logging = kfxCordova.kfxUtilities.createLogging();
+ * Logging.disableMobileSDKLogging(function(disableLoggingSuccess){
+ *       alert(JSON.stringify(disableLoggingSuccess));
+ * },function(disableLoggingError){
+ *       alert(JSON.stringify(disableLoggingError));
+ * });
+ */
+
+Logging.prototype.disableMobileSDKLogging = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutDisableLogging,
+		[]
+	);
+};
+
+/// Sets the levels, sampling, queueing and output of the SDK logging.
+/**
+ * Configures the asynchronous SDK logging. Log records are put on a bounded queue and written by a background thread, so the
+ * calling thread never waits for the file system. When the queue is full new records are dropped and counted instead of blocking;
+ * the counters are available through getLoggingStats. Each module has its own level, and hot paths such as the per-frame
+ * capture callbacks can be sampled or rate limited so that logging can stay enabled in production.
+ *
+ * The levels are also applied to the records logged by the application through the log method, before they are sent to native.
+ *
+ * The asynchronous logging needs a newer native kfxPlugin than the one shipped in lib/. On a native layer without it, the levels
+ * and sampling still filter the records of the log method, which are then written to the console, and the errorCallback gets
+ * {ErrorMsg: "Invalid action", ErrorDesc} for the native options.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} [parameters] - A JSON object with the logging options. Options which are not given keep their current value.
+ * @param {String} [parameters.defaultLevel = "INFO"] - level of the modules not listed in moduleLevels. One of OFF, ERROR, WARNING, INFO, DEBUG, VERBOSE.
+ * @param {Object} [parameters.moduleLevels] - level per module, for example {CAPTURE: "WARNING", ENGINES: "INFO", LOGISTICS: "DEBUG", NFC: "OFF"}
+ * @param {Object} [parameters.sampling] - sampling per module as {rate, maxPerSecond}, where rate is the fraction of records kept (0 to 1) and maxPerSecond caps the records kept per second
+ * @param {Number} [parameters.queueCapacity = 1024] - maximum number of records waiting for the writer thread. The application records of the log method which are queued or sent but not yet taken by native count against it as well.
+ * @param {Number} [parameters.batchSize = 64] - number of application records sent to native together
+ * @param {Number} [parameters.flushInterval = 1000] - maximum time in milliseconds an application record waits before being sent to native
+ * @param {Object} [parameters.output] - where the records are written. When omitted they are written to the console only.
+ * @param {String} [parameters.output.directory] - directory of the log files
+ * @param {String} [parameters.output.format = "NDJSON"] - "NDJSON" writes one JSON object per line, "BINARY" writes the compact binary record format
+ * @param {Number} [parameters.output.maxFileSize = 1048576] - size in bytes after which the file is rotated
+ * @param {Number} [parameters.output.maxFiles = 5] - number of rotated files kept, the oldest is deleted first
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS    if the options are set successfully.
+ * errorCallback -    error message would contain the error description. Possible error objects are Wrong Parameters, KmcRuntimeException,Exception.
+ *
+ * @example
+ * var Logging = kfxCordova.kfxUtilities.createLogging();
+ * Logging.setLoggingOptions(successCallback, errorCallback, {
+ *       defaultLevel: "WARNING",
+ *       moduleLevels: {LOGISTICS: "DEBUG"},
+ *       sampling: {CAPTURE: {rate: 0.1, maxPerSecond: 20}},
+ *       output: {directory: cordova.file.dataDirectory + "logs", format: "NDJSON", maxFiles: 3}
+ * });
+ */
+Logging.prototype.setLoggingOptions = function (successCallback, errorCallback, parameters) {
+	parameters = parameters || {};
+	["defaultLevel", "moduleLevels", "sampling", "queueCapacity", "batchSize", "flushInterval"].forEach(function (key) {
+		if (parameters[key] !== undefined) loggingOptions[key] = parameters[key];
+	});
+	rateWindows = {};
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutSetLoggingOptions,
+		[parameters]
+	);
+};
+
+/// Logs an application record through the SDK logging pipeline.
+/**
+ * Records below the level of the module, or dropped by its sampling options, are discarded here without crossing the bridge.
+ * The others are queued and sent to native in batches, where they are written with the SDK records. When queueCapacity records
+ * are already queued or waiting for native, the record is dropped and counted as overflow. Records which native fails to take
+ * are written to the console and counted as failed.
+ *
+ * @param {String} module - module name, either one of the SDK modules or any application defined name
+ * @param {String} level - one of ERROR, WARNING, INFO, DEBUG, VERBOSE
+ * @param {String} message - the log message
+ * @param {Object} [fields] - additional structured fields written with the record
+ *
+ * @return true if the record was queued, false if it was filtered or dropped.
+ *
+ * @example
+ * var Logging = kfxCordova.kfxUtilities.createLogging();
+ * Logging.log("CAPTURE", "DEBUG", "frame analysed", {stability: 82});
+ */
+Logging.prototype.log = function (module, level, message, fields) {
+	var moduleLevel = loggingOptions.moduleLevels[module] || loggingOptions.defaultLevel;
+	if (levelRank(level) > levelRank(moduleLevel) || level === "OFF") return false;
+	var reason = samplingDecision(module);
+	if (reason) {
+		countDrop(module, reason);
+		return false;
+	}
+	if (recordQueue.length + recordsInFlight >= loggingOptions.queueCapacity) {
+		countDrop(module, "overflow");
+		return false;
+	}
+	recordQueue.push({ time: Date.now(), module: module, level: level, message: message, fields: fields });
+	if (recordQueue.length >= Math.min(loggingOptions.batchSize, loggingOptions.queueCapacity)) {
+		flushRecords();
+	} else if (!flushTimer) {
+		flushTimer = setTimeout(flushRecords, loggingOptions.flushInterval);
+	}
+	return true;
+};
+
+/// Writes all queued log records.
+/**
+ * Sends the queued application records to native and waits until the writer thread has written every queued record to the log file.
+ * Call it before reading or uploading the log files. When native fails to take the queued records, errorCallback gets that error
+ * and the writer thread is not waited for.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @example
+ * var Logging = kfxCordova.kfxUtilities.createLogging();
+ * Logging.flushLogs(successCallback, errorCallback);
+ */
+Logging.prototype.flushLogs = function (successCallback, errorCallback) {
+	flushRecords(function () {
+		ActionUtils.execExtended(
+			function (result) {
+				if (successCallback) successCallback(result);
+			},
+			function (error) {
+				if (errorCallback) errorCallback(error);
+			},
+			ActionUtils.serviceName,
+			ActionUtils.kutFlushLogs,
+			[],
+			function () {
+				if (successCallback) successCallback("KMC_SUCCESS");
+			}
+		);
+	}, errorCallback);
+};
+
+/// Gets the logging counters.
+/**
+ * @param {Function} successCallback - called with the counters per module: {MODULE: {written, overflow, rateLimited, sampled, failed}},
+ * plus 'queueDepth', the number of records waiting for the writer thread, and 'files', the current log files. The counters of the
+ * application records dropped before reaching native are included; on a native layer without kutGetLoggingStats they are the
+ * only counters.
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @example
+ * var Logging = kfxCordova.kfxUtilities.createLogging();
+ * Logging.getLoggingStats(function(stats){
+ *       alert(JSON.stringify(stats.CAPTURE));
+ * },errorCallback);
+ */
+Logging.prototype.getLoggingStats = function (successCallback, errorCallback) {
+	var report = function (result) {
+		Object.keys(droppedRecords).forEach(function (module) {
+			var counters = result[module] || (result[module] = { written: 0, overflow: 0, rateLimited: 0, sampled: 0 });
+			Object.keys(droppedRecords[module]).forEach(function (reason) {
+				counters[reason] = (counters[reason] || 0) + droppedRecords[module][reason];
+			});
+		});
+		if (successCallback) successCallback(result);
+	};
+	ActionUtils.execExtended(
+		report,
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kutGetLoggingStats,
+		[],
+		function () {
+			report({ queueDepth: recordQueue.length + recordsInFlight, files: [] });
+		}
+	);
+};
+
+//End of Logging Methods
+
+// Methods taking (successCallback, errorCallback, ...), for PromiseUtils.promisify
+PromiseUtils.registerCallbackMethods(Logging, [
+	"enableMobileSDKLogging",
+	"disableMobileSDKLogging",
+	"setLoggingOptions",
+	"flushLogs",
+	"getLoggingStats",
+]);
+
+module.exports = Logging;
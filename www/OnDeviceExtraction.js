@@ -1,611 +1,743 @@
-//
-//OnDeviceExtraction.js
-//
-//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
-
-var ActionUtils = require("./ActionUtils");
-var ImageObject = require("./ImageObject");
-
-/// A variable/Object to access the native SDK methods of OnDeviceExtraction class(es)
-/**  An instance of this class contains methods to extract the images and gets the results.
- *  SDK shall integrate on-device classification and extraction models for IDs.currently it supports only IDs.
- * On-device extraction will not be supported for all regions, it may vary based on ID Type(DL/Passport).
- *
- * @class
- * @alias OnDeviceExtraction
- * @constructor
- *
- */
-//OnDeviceExtraction constructor and corresponding methods
-var OnDeviceExtraction = function () {};
-
-//Get the OnDeviceExtraction supported regions.
-/**
- * Get the OnDeviceExtraction supported regions
- *
- * @example
- *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *   var regions = OnDeviceExtraction.getRegions();
- *  alert(JSON.stringify(regions));
- */
-OnDeviceExtraction.prototype.getRegions = function () {
-	var regions = {
-		US: "US",
-		ASIA: "ASIA",
-		CANADA: "CANADA",
-		EUROPE: "EUROPE",
-		LATIN_AMERICA: "LATIN_AMERICA",
-		AUSTRALIA: "AUSTRALIA",
-	};
-	return regions;
-};
-
-//Get the OnDeviceExtraction supported providers.
-/**
- * Get the OnDeviceExtraction supported cache providers
- *
- * @example
- *   var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *   var providers = OnDeviceExtraction.getProviders();//Supported cache providers are provider.LOCAL,provider.SERVER
- *   alert(JSON.stringify(providers));
- */
-OnDeviceExtraction.prototype.getProviders = function () {
-	var Provider = {
-		LOCAL: 0,
-		SERVER: 1,
-	};
-	return Provider;
-};
-
-//Get the OnDeviceExtraction supported ID types.
-/**
- * Get the OnDeviceExtraction supported ID types.
- *
- * @example
- *   var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *   var idTypes = OnDeviceExtraction.getIDTypes();
- *   alert(JSON.stringify(idTypes));
- */
-OnDeviceExtraction.prototype.getIDTypes = function () {
-	var idTypes = {
-		ID: 0,
-		PASSPORT: 1,
-	};
-	return idTypes;
-};
-
-//Get the Project name based on region and IDType.
-/**
- * Get the Project name based on region and IDType.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} parameters - parameters which are used to get project name.
- *
- * @param {String} [parameters.region]
- *     Name of the region.
- *
- * @param {String} [parameters.IDType]
- *     It will be determined the type of ID. Allowable values are Id,Passport.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -   The successCallBack consists of Project Name.
- * errorCallback -    Error message would contain the appropriate error description.Possible error objects are Wrong Parameters & Exception.
- *
- * @example
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *   var region = OnDeviceExtraction.getRegions();
- *   var idType = OnDeviceExtraction.getIDTypes();
- *   var parameters = {
- *            region: region.US,    //region.ASIA,region.CANADA,etc.
- *            IDType: idType.ID
- *   };
- *   OnDeviceExtraction.getProjectName(function(projectName){
- *                                              alert("Name of the project:: "+projectName);
- *                                     },function(error){
- *                                       alert(JSON.stringify(error));
- *                                     }, parameters);
- *
- */
-OnDeviceExtraction.prototype.getProjectName = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODEGetProjectName,
-		[parameters]
-	);
-};
-
-//Method to set provider.
-/**
- *This method sets provider to extractor.The provider may be Local cache provider or server cache provider.Setting provider is mandatory before performing extraction.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object}   setProviderOptions -  A JSON object contains the options to be set to  OnDeviceExtraction object.The options consists of which provider to be set to OnDeviceExtraction to perform extraction.
- *
- * @param {Number} [setProviderOptions.provider]
- *    Provider which is used for on device extraction.OnDeviceExtraction supports two providers.Local provider and server provider.Allowable values are Provider.LOCAL,Provider.SERVER.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.The successCallBack consists of path to specified project files
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
- *
- * @example
- *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *        var provider = OnDeviceExtraction.getProviders();
- *        var selectedProvider=provider.LOCAL;//Allowable values are provider.LOCAL, provider.SERVER
- *
- *  var setProviderOptions={
- *     provider:selectedProvider
- * };
- *
- *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *  OnDeviceExtraction.setProvider(function(success){
- *    alert(JSON.stringify(success));
- * },function(error){
- *      alert(JSON.stringify(error));
- * },setProviderOptions);
- */
-OnDeviceExtraction.prototype.setProvider = function (successCallback, errorCallback, setProviderOptions) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODESetProvider,
-		[setProviderOptions]
-	);
-};
-
-/// To Extract Front, Back or Front & Back images.
-/**
- * Use this method when you want to perform on-device classification and extraction models for IDs.
- * SDK will allow On-Device Extraction process only if the SDK system license enabled.if device license count is zero then OndeviceExtraction callback will be called immediately with null results and errors for both sides.
- * The region parameter is required; it is considered an error to pass null.
- * Neither the front nor the back image are required and may be null.  If both front- and back-side images are provided, the extraction for each image will be performed concurrently.
- * The results for both images will be merged into a single result, the order of the elements is undefined.
- * if the extraction completes without error then extractionResultsCallback(passed in addOnDeviceExtractionListener api) Callback will get the extraction results otherwise will get an errors.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- * @param {Object} parameters - parameters which are used to extract the fields
- *
- * @param {String} [parameters.region]
- *    The region types will be determined by the classification/extraction models.
- *
- * @param {String} [parameters.IDType]
- *    It will be determined the type of ID. Allowable values are Id,Passport.
- *
- * @param {String} [parameters.frontImageId]
- *    front image object that you want to extract. An image id in the ImageArray is to be passes as argument.
- *
- * @param {Object[]} [parameters.frontBarcodeArray]
- *     Array of front-side barcode data which is coming from barcode capture experience that you want to extract. The barcode strings extracted from the Barcode detector is to be passes as argument.
- *
- * @param {String} [parameters.backImageId]
- *     back image object that you want to extract. An image id in the ImageArray is to be passes as argument.
- *
- * @param {Object[]} [parameters.backBarcodeArray]
- *     Array of back-side barcode data which is coming from barcode capture experience that you want to extract. The barcode strings extracted from the Barcode detector is to be passes as argument.
- *
- * @param {String} [parameters.isProcessed]
- *     Whether the images passed are pre-processed or not. If true, the SDK will not pre-process both images before extraction. Otherwise, any processing required will be handled internally by the SDK.
- * @return
- *    The return value is captured in the 'successCallback' function. This method returns KMC_SUCCESS when the extraction was started up successfully.
- *    Several error codes are returned for this method when the extraction request could not be started.
- *    Extraction error is constructed using the following rules:
- *  - If only one image (either front or back) is sent for extraction and an error occurred at some step, the extractionResultsCallback will be called with null results and error code for the corresponding side and KMC_SUCCESS code for the other side.
- *  - If both images are sent and error occurred during the extraction of only one of them, the results of the successful extraction will get extractionResultsCallback. Error code for the failed side and KMC_SUCCESS code for the other side.
- *  - If both images are provided and both extraction fail, extraction results will be nil and will contain corresponding error codes.
- *  - If none image is provided, extractionResultsCallback will be called immediately with nil results and errors for both sides.
- *
- *    The possible error codes are:
- *    KMC_UT_LICENSE_ID_EXTRACTION: Required ID extraction license not found.Please make sure the application is using the correct license string.
- *    KMC_UT_OUT_OF_VOLUME_LICENSE: Required license volume not available.Please make sure your license server is configured properly.
- *    KMC_EX_NOIMAGE: No bitmap image was specified for extraction.
- *
- * @see
- *    Use - {@link OnDeviceExtraction#cancelExctaction cancelExctaction} to cancel an extraction operation if necessary.
- *
- * @example
- *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *   var region = OnDeviceExtraction.getRegions();
- *   var idType = OnDeviceExtraction.getIDTypes();
- *   var parameters = {
- *            region: region.US,    //region.ASIA,region.CANADA,etc.
- *            IDType: idType.ID,
- *            frontImageId: frontID,
- *            frontBarcode: [],
- *            backImageId: backID,
- *            backBarcode: [],
- *            isProcessed: false
- *   };
- *
- * OnDeviceExtraction.extractFields(function(success){
- *    alert(JSON.stringify(success));
- * },function(error){
- *    alert(JSON.stringify(error));
- * }, parameters);
- */
-OnDeviceExtraction.prototype.extractFields = function (successCallback, errorCallback, parameters) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODEExtractData,
-		[parameters]
-	);
-};
-
-///To cancel the extraction process.
-/**
- * Use the CancelExtraction method to cancel an extraction processing operation that is underway.
- *
- * @param {Function} successCallback - Default Success call back function name
- * @param {Function} errorCallback - Default Error call back function name
- *
- * @return
- *  successCallback -  KMC_SUCCESS success call back
- *  errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *
- * OnDeviceExtraction.cancelExtraction(function(success){
- *  alert(JSON.stringify(success));
- * }, function(error){
- *  alert(JSON.stringify(error));
- * });
- */
-
-OnDeviceExtraction.prototype.cancelExtraction = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODECancelExtraction,
-		[]
-	);
-};
-
-/// Method to add the event listener to the extracted results of ondeviceExtraction.
-/**
- * This method would receive the on extracted results at the ondeviceExtraction. Importantly ownership of faceImage and signatureImage should be taken care by user
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error Call back function name
- * @param {Function} extractionResultsCallback - Extraction results are returned in this variable in the form a JSON object.
- *
- *
- * @return
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback  -    Error object would contain either JSON Object or error message string.if it has json object it contains front or back or both error messages.Check below example code for how to handle error object.
- * extractionResultsCallback - Extraction results are returned in this variable in the form a JSON object.This json object contains data as mentioned below.
- *               -> If both images are sent and error occurred during the extraction of only one of them, the JSON object will contain array of extracted dataFields and error code for the failed side.
- *               -> If one or both Images are sent and get extraction success then json object contains only array of extracted dataFields.
- *               -> It would also contain Face Image and Signature Image based on the returned results
- *
- * @example
- * dataField object is mentioned as below.
- *  ex:  var dataField ={
- *        fieldName:"name",
- *        fieldValue:"value",
- *        fieldConfidence:0.0,
- *        fieldLocation : {
- *                  x     : 0.0,
- *                  y     : 0.0,
- *                  width : 0.0,
- *                  height: 0.0
- *                }
- *      };
- *
- *
- *
- * var extractionResultsCallback = function(result){
- *   var dataFields = result.extractionResults;
- *   var faceImageObject = result.faceImage;
- *   var signatureImageObject = result.signatureImage;
- *            if(result.hasOwnProperty('extractionFrontError')){
- *              alert("Front error:: " + result.extractionFrontError);
- *              }
- *              if(result.hasOwnProperty('extractionBackError')){
- *                      alert("Back error:: " + result.extractionBackError);
- *                  }
- *
- *   console.log("Extraction Result: ");
- *   for(var i = 0; i < dataFields.length; i++){
- *      var name = dataFields[i].fieldName;
- *      var value = dataFields[i].fieldValue;
- *      var confidence = dataFields[i].fieldConfidence;
- *      var fieldLocation_x =  dataFields[i].fieldLocation.x;
- *      var fieldLocation_y =  dataFields[i].fieldLocation.y;
- *      var fieldLocation_width =  dataFields[i].fieldLocation.width;
- *      var fieldLocation_height =  dataFields[i].fieldLocation.height;
- *      console.log("Field Name:"+ name +" Field Value: "+value+" confidence:"+confidence+" fieldLocation_x:"+fieldLocation_x+" fieldLocation_y:"+fieldLocation_y+" fieldLocation_width:"+fieldLocation_width+" fieldLocation_height:"+fieldLocation_height);
- *   }
- *
- *   var error = result.extractionError;
- * }
- *
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *
- * OnDeviceExtraction.addOnDeviceExtractionListener(function(success){
- *    alert(JSON.stringify(success));
- * },function(error){
- *    if(!error.hasOwnProperty('extractionFrontError') && !error.hasOwnProperty('extractionBackError')){
- *                    alert("error in addOnDeviceExtractionListener :" + JSON.stringify(error));
- *    }else{
- *            if(error.hasOwnProperty('extractionFrontError')){
- *              alert("Front error:: " + error.extractionFrontError);
- *              }
- *              if(error.hasOwnProperty('extractionBackError')){
- *                      alert("Back error:: " + error.extractionBackError);
- *                  }
- *    }
- * }, extractionResultsCallback);
- */
-
-OnDeviceExtraction.prototype.addOnDeviceExtractionListener = function (
-	successCallback,
-	errorCallback,
-	extractionResultsCallback
-) {
-	ActionUtils.exec(
-		function (result) {
-			if (result.eventType === "eventRegistered") {
-				if (successCallback) successCallback(result);
-			} else if (result.eventType === "eventRaised") {
-				if (extractionResultsCallback) extractionResultsCallback(result);
-			}
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODEAddOnDeviceExtractionListener,
-		[]
-	);
-};
-
-/// This method is called when the front image processing is complete.
-/**
- * If image processing is disabled, the callback will contain the original image. Importantly user should take the ownership of the imageObject.
- * If no front image was provided, no callback will be raised.
- * If image processing failed or extraction was canceled before processing finished, no callback will be raised, and the appropriate errors will be returned from the kfxKOEIDExtractorDelegate.
- *
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error Call back function name
- * @param {Function} processedImageCallback - A JSON object containing the properties of the captured image object. Check the 'Image'  object for its properties.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
- * processedImageCallback - will have the JSON object of the captured KfxKEDImage properties. The captured Image is stored in ImageArray.
- * The image can be retrieved using methods on ImageArray.
- *
- * @example
- * function processedImageCallback(imageObject)
- * {
- *      alert(JSON.stringify(imageObject));
- * }
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- * OnDeviceExtraction.addFrontProcessedImageListener(successCallback, errorCallback, processedImageCallback);
- */
-OnDeviceExtraction.prototype.addFrontProcessedImageListener = function (
-	successCallback,
-	errorCallback,
-	processedImageCallback
-) {
-	ActionUtils.exec(
-		function (result) {
-			if (result.eventType === "eventRegistered") {
-				if (successCallback) successCallback(result);
-			} else if (result.eventType === "eventRaised") {
-				var imgObject = new ImageObject(result);
-				if (processedImageCallback) processedImageCallback(imgObject);
-			}
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODEAddFrontProcessedImageListener,
-		[]
-	);
-};
-
-/// This method is called when the back image processing is complete.
-/**
- * If image processing is disabled, the callback will contain the original image. Importantly user should take the ownership of the imageObject.
- * If no back image was provided, no callback will be raised.
- * If image processing failed or extraction was canceled before processing finished, no callback will be raised, and the appropriate errors will be returned from the kfxKOEIDExtractorDelegate.
- * Note: In certain cases, if the provided unprocessed image is known to contain only a barcode and no other useful information, processing may be skipped, and the original image will be returned.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error Call back function name
- * @param {Function} processedImageCallback - A JSON object containing the properties of the captured image object. Check the 'Image'  object for its properties.
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back.
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
- * processedImageCallback - will have the JSON object of the captured KfxKEDImage properties. The captured Image is stored in ImageArray.
- * The image can be retrieved using methods on ImageArray.
- *
- * @example
- * function processedImageCallback(imageObject)
- * {
- *      alert(JSON.stringify(imageObject));
- * }
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- * OnDeviceExtraction.addBackProcessedImageListener(successCallback, errorCallback, processedImageCallback);
- */
-OnDeviceExtraction.prototype.addBackProcessedImageListener = function (
-	successCallback,
-	errorCallback,
-	processedImageCallback
-) {
-	ActionUtils.exec(
-		function (result) {
-			if (result.eventType === "eventRegistered") {
-				if (successCallback) successCallback(result);
-			} else if (result.eventType === "eventRaised") {
-				var imgObject = new ImageObject(result);
-				if (processedImageCallback) processedImageCallback(imgObject);
-			}
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODEAddBackProcessedImageListener,
-		[]
-	);
-};
-
-/// Method to remove the event listener to the frontProcessedImage method of the  Extraction call back
-/**
- * The method would remove the listener to the delegate call back of the frontProcessedImage method. After removing the listener,
- * there will not be any call backs from native from the Image Processing delegate methods even when  it is being called in native.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error Call back function name
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- * OnDeviceExtraction.removeFrontProcessedImageListener(successCallback, errorCallback);
- */
-OnDeviceExtraction.prototype.removeFrontProcessedImageListener = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODERemoveFrontProcessedImageListener,
-		[]
-	);
-};
-
-/// Method to remove the event listener to the backProcessedImage method of the  Extraction call back
-/**
- * The method would remove the listener to the delegate call back of the backProcessedImage method. After removing the listener,
- * there will not be any call backs from native from the Image Processing delegate methods even when  it is being called in native.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error Call back function name
- *
- * @return
- * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
- * successCallback -  KMC_SUCCESS success call back
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * function successCallback(response){
- *       alert(JSON.stringify(response));
- * }
- * function errorCallback(error){
- *       alert(JSON.stringify(error));
- * }
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- * OnDeviceExtraction.removeBackProcessedImageListener(successCallback, errorCallback);
- */
-OnDeviceExtraction.prototype.removeBackProcessedImageListener = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODERemoveBackProcessedImageListener,
-		[]
-	);
-};
-
-/// Method to remove the event listener to the extracted results of ondeviceExtraction.
-/**
- * The method would remove the listener and would not receive the extracted results events. After removing the listener,
- * there will not be any call backs from native.
- *
- * @param {Function} successCallback - Default Success Call back function name
- * @param {Function} errorCallback - Default Error Call back function name
- *
- *
- * @return
- * successCallback -  KMC_SUCCESS success call back
- * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
- *
- * @example
- * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
- *
- * OnDeviceExtraction.removeOnDeviceExtractionListener(function(success){
- *  alert(JSON.stringify(success));
- * }, function(error){
- *  alert(JSON.stringify(error));
- * });
- */
-
-OnDeviceExtraction.prototype.removeOnDeviceExtractionListener = function (successCallback, errorCallback) {
-	ActionUtils.exec(
-		function (result) {
-			if (successCallback) successCallback(result);
-		},
-		function (error) {
-			if (errorCallback) errorCallback(error);
-		},
-		ActionUtils.serviceName,
-		ActionUtils.kenODERemoveOnDeviceExtractionListener,
-		[]
-	);
-};
-
-//End of OnDeviceExtraction methods
-module.exports = OnDeviceExtraction;
+//
+//OnDeviceExtraction.js
+//
+//  Copyright (c) 2012 - 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+var PromiseUtils = require("./PromiseUtils");
+var ImageObject = require("./ImageObject");
+
+/// A variable/Object to access the native SDK methods of OnDeviceExtraction class(es)
+/**  An instance of this class contains methods to extract the images and gets the results.
+ *  SDK shall integrate on-device classification and extraction models for IDs.currently it supports only IDs.
+ * On-device extraction will not be supported for all regions, it may vary based on ID Type(DL/Passport).
+ *
+ * @class
+ * @alias OnDeviceExtraction
+ * @constructor
+ *
+ */
+//OnDeviceExtraction constructor and corresponding methods
+var OnDeviceExtraction = function () {};
+
+//Get the OnDeviceExtraction supported regions.
+/**
+ * Get the OnDeviceExtraction supported regions
+ *
+ * @example
+ *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *   var regions = OnDeviceExtraction.getRegions();
+ *  alert(JSON.stringify(regions));
+ */
+OnDeviceExtraction.prototype.getRegions = function () {
+	var regions = {
+		US: "US",
+		ASIA: "ASIA",
+		CANADA: "CANADA",
+		EUROPE: "EUROPE",
+		LATIN_AMERICA: "LATIN_AMERICA",
+		AUSTRALIA: "AUSTRALIA",
+	};
+	return regions;
+};
+
+//Get the OnDeviceExtraction supported providers.
+/**
+ * Get the OnDeviceExtraction supported cache providers
+ *
+ * @example
+ *   var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *   var providers = OnDeviceExtraction.getProviders();//Supported cache providers are provider.LOCAL,provider.SERVER
+ *   alert(JSON.stringify(providers));
+ */
+OnDeviceExtraction.prototype.getProviders = function () {
+	var Provider = {
+		LOCAL: 0,
+		SERVER: 1,
+	};
+	return Provider;
+};
+
+//Get the OnDeviceExtraction supported ID types.
+/**
+ * Get the OnDeviceExtraction supported ID types.
+ *
+ * @example
+ *   var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *   var idTypes = OnDeviceExtraction.getIDTypes();
+ *   alert(JSON.stringify(idTypes));
+ */
+OnDeviceExtraction.prototype.getIDTypes = function () {
+	var idTypes = {
+		ID: 0,
+		PASSPORT: 1,
+	};
+	return idTypes;
+};
+
+//Get the Project name based on region and IDType.
+/**
+ * Get the Project name based on region and IDType.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - parameters which are used to get project name.
+ *
+ * @param {String} [parameters.region]
+ *     Name of the region.
+ *
+ * @param {String} [parameters.IDType]
+ *     It will be determined the type of ID. Allowable values are Id,Passport.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -   The successCallBack consists of Project Name.
+ * errorCallback -    Error message would contain the appropriate error description.Possible error objects are Wrong Parameters & Exception.
+ *
+ * @example
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *   var region = OnDeviceExtraction.getRegions();
+ *   var idType = OnDeviceExtraction.getIDTypes();
+ *   var parameters = {
+ *            region: region.US,    //region.ASIA,region.CANADA,etc.
+ *            IDType: idType.ID
+ *   };
+ *   OnDeviceExtraction.getProjectName(function(projectName){
+ *                                              alert("Name of the project:: "+projectName);
+ *                                     },function(error){
+ *                                       alert(JSON.stringify(error));
+ *                                     }, parameters);
+ *
+ */
+OnDeviceExtraction.prototype.getProjectName = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEGetProjectName,
+		[parameters]
+	);
+};
+
+//Method to set provider.
+/**
+ *This method sets provider to extractor.The provider may be Local cache provider or server cache provider.Setting provider is mandatory before performing extraction.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object}   setProviderOptions -  A JSON object contains the options to be set to  OnDeviceExtraction object.The options consists of which provider to be set to OnDeviceExtraction to perform extraction.
+ *
+ * @param {Number} [setProviderOptions.provider]
+ *    Provider which is used for on device extraction.OnDeviceExtraction supports two providers.Local provider and server provider.Allowable values are Provider.LOCAL,Provider.SERVER.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.The successCallBack consists of path to specified project files
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
+ *
+ * @example
+ *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *        var provider = OnDeviceExtraction.getProviders();
+ *        var selectedProvider=provider.LOCAL;//Allowable values are provider.LOCAL, provider.SERVER
+ *
+ *  var setProviderOptions={
+ *     provider:selectedProvider
+ * };
+ *
+ *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *  OnDeviceExtraction.setProvider(function(success){
+ *    alert(JSON.stringify(success));
+ * },function(error){
+ *      alert(JSON.stringify(error));
+ * },setProviderOptions);
+ */
+OnDeviceExtraction.prototype.setProvider = function (successCallback, errorCallback, setProviderOptions) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODESetProvider,
+		[setProviderOptions]
+	);
+};
+
+/// To Extract Front, Back or Front & Back images.
+/**
+ * Use this method when you want to perform on-device classification and extraction models for IDs.
+ * SDK will allow On-Device Extraction process only if the SDK system license enabled.if device license count is zero then OndeviceExtraction callback will be called immediately with null results and errors for both sides.
+ * The region parameter is required; it is considered an error to pass null.
+ * Neither the front nor the back image are required and may be null.  If both front- and back-side images are provided, the extraction for each image will be performed concurrently.
+ * The results for both images will be merged into a single result, the order of the elements is undefined.
+ * if the extraction completes without error then extractionResultsCallback(passed in addOnDeviceExtractionListener api) Callback will get the extraction results otherwise will get an errors.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - parameters which are used to extract the fields
+ *
+ * @param {String} [parameters.region]
+ *    The region types will be determined by the classification/extraction models.
+ *
+ * @param {String} [parameters.IDType]
+ *    It will be determined the type of ID. Allowable values are Id,Passport.
+ *
+ * @param {String} [parameters.frontImageId]
+ *    front image object that you want to extract. An image id in the ImageArray is to be passes as argument.
+ *
+ * @param {Object[]} [parameters.frontBarcodeArray]
+ *     Array of front-side barcode data which is coming from barcode capture experience that you want to extract. The barcode strings extracted from the Barcode detector is to be passes as argument.
+ *
+ * @param {String} [parameters.backImageId]
+ *     back image object that you want to extract. An image id in the ImageArray is to be passes as argument.
+ *
+ * @param {Object[]} [parameters.backBarcodeArray]
+ *     Array of back-side barcode data which is coming from barcode capture experience that you want to extract. The barcode strings extracted from the Barcode detector is to be passes as argument.
+ *
+ * @param {String} [parameters.isProcessed]
+ *     Whether the images passed are pre-processed or not. If true, the SDK will not pre-process both images before extraction. Otherwise, any processing required will be handled internally by the SDK.
+ * @return
+ *    The return value is captured in the 'successCallback' function. This method returns KMC_SUCCESS when the extraction was started up successfully.
+ *    Several error codes are returned for this method when the extraction request could not be started.
+ *    Extraction error is constructed using the following rules:
+ *  - If only one image (either front or back) is sent for extraction and an error occurred at some step, the extractionResultsCallback will be called with null results and error code for the corresponding side and KMC_SUCCESS code for the other side.
+ *  - If both images are sent and error occurred during the extraction of only one of them, the results of the successful extraction will get extractionResultsCallback. Error code for the failed side and KMC_SUCCESS code for the other side.
+ *  - If both images are provided and both extraction fail, extraction results will be nil and will contain corresponding error codes.
+ *  - If none image is provided, extractionResultsCallback will be called immediately with nil results and errors for both sides.
+ *
+ *    The possible error codes are:
+ *    KMC_UT_LICENSE_ID_EXTRACTION: Required ID extraction license not found.Please make sure the application is using the correct license string.
+ *    KMC_UT_OUT_OF_VOLUME_LICENSE: Required license volume not available.Please make sure your license server is configured properly.
+ *    KMC_EX_NOIMAGE: No bitmap image was specified for extraction.
+ *
+ * @see
+ *    Use - {@link OnDeviceExtraction#cancelExctaction cancelExctaction} to cancel an extraction operation if necessary.
+ *
+ * @example
+ *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *   var region = OnDeviceExtraction.getRegions();
+ *   var idType = OnDeviceExtraction.getIDTypes();
+ *   var parameters = {
+ *            region: region.US,    //region.ASIA,region.CANADA,etc.
+ *            IDType: idType.ID,
+ *            frontImageId: frontID,
+ *            frontBarcode: [],
+ *            backImageId: backID,
+ *            backBarcode: [],
+ *            isProcessed: false
+ *   };
+ *
+ * OnDeviceExtraction.extractFields(function(success){
+ *    alert(JSON.stringify(success));
+ * },function(error){
+ *    alert(JSON.stringify(error));
+ * }, parameters);
+ */
+OnDeviceExtraction.prototype.extractFields = function (successCallback, errorCallback, parameters) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEExtractData,
+		[parameters]
+	);
+};
+
+///To cancel the extraction process.
+/**
+ * Use the CancelExtraction method to cancel an extraction processing operation that is underway.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ *  successCallback -  KMC_SUCCESS success call back
+ *  errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *
+ * OnDeviceExtraction.cancelExtraction(function(success){
+ *  alert(JSON.stringify(success));
+ * }, function(error){
+ *  alert(JSON.stringify(error));
+ * });
+ */
+
+OnDeviceExtraction.prototype.cancelExtraction = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODECancelExtraction,
+		[]
+	);
+};
+
+/// Method to add the event listener to the extracted results of ondeviceExtraction.
+/**
+ * This method would receive the on extracted results at the ondeviceExtraction. Importantly ownership of faceImage and signatureImage should be taken care by user
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error Call back function name
+ * @param {Function} extractionResultsCallback - Extraction results are returned in this variable in the form a JSON object.
+ *
+ *
+ * @return
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback  -    Error object would contain either JSON Object or error message string.if it has json object it contains front or back or both error messages.Check below example code for how to handle error object.
+ * extractionResultsCallback - Extraction results are returned in this variable in the form a JSON object.This json object contains data as mentioned below.
+ *               -> If both images are sent and error occurred during the extraction of only one of them, the JSON object will contain array of extracted dataFields and error code for the failed side.
+ *               -> If one or both Images are sent and get extraction success then json object contains only array of extracted dataFields.
+ *               -> It would also contain Face Image and Signature Image based on the returned results
+ *
+ * @example
+ * dataField object is mentioned as below.
+ *  ex:  var dataField ={
+ *        fieldName:"name",
+ *        fieldValue:"value",
+ *        fieldConfidence:0.0,
+ *        fieldLocation : {
+ *                  x     : 0.0,
+ *                  y     : 0.0,
+ *                  width : 0.0,
+ *                  height: 0.0
+ *                }
+ *      };
+ *
+ *
+ *
+ * var extractionResultsCallback = function(result){
+ *   var dataFields = result.extractionResults;
+ *   var faceImageObject = result.faceImage;
+ *   var signatureImageObject = result.signatureImage;
+ *            if(result.hasOwnProperty('extractionFrontError')){
+ *              alert("Front error:: " + result.extractionFrontError);
+ *              }
+ *              if(result.hasOwnProperty('extractionBackError')){
+ *                      alert("Back error:: " + result.extractionBackError);
+ *                  }
+ *
+ *   console.log("Extraction Result: ");
+ *   for(var i = 0; i < dataFields.length; i++){
+ *      var name = dataFields[i].fieldName;
+ *      var value = dataFields[i].fieldValue;
+ *      var confidence = dataFields[i].fieldConfidence;
+ *      var fieldLocation_x =  dataFields[i].fieldLocation.x;
+ *      var fieldLocation_y =  dataFields[i].fieldLocation.y;
+ *      var fieldLocation_width =  dataFields[i].fieldLocation.width;
+ *      var fieldLocation_height =  dataFields[i].fieldLocation.height;
+ *      console.log("Field Name:"+ name +" Field Value: "+value+" confidence:"+confidence+" fieldLocation_x:"+fieldLocation_x+" fieldLocation_y:"+fieldLocation_y+" fieldLocation_width:"+fieldLocation_width+" fieldLocation_height:"+fieldLocation_height);
+ *   }
+ *
+ *   var error = result.extractionError;
+ * }
+ *
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *
+ * OnDeviceExtraction.addOnDeviceExtractionListener(function(success){
+ *    alert(JSON.stringify(success));
+ * },function(error){
+ *    if(!error.hasOwnProperty('extractionFrontError') && !error.hasOwnProperty('extractionBackError')){
+ *                    alert("error in addOnDeviceExtractionListener :" + JSON.stringify(error));
+ *    }else{
+ *            if(error.hasOwnProperty('extractionFrontError')){
+ *              alert("Front error:: " + error.extractionFrontError);
+ *              }
+ *              if(error.hasOwnProperty('extractionBackError')){
+ *                      alert("Back error:: " + error.extractionBackError);
+ *                  }
+ *    }
+ * }, extractionResultsCallback);
+ */
+
+OnDeviceExtraction.prototype.addOnDeviceExtractionListener = function (
+	successCallback,
+	errorCallback,
+	extractionResultsCallback
+) {
+	ActionUtils.exec(
+		function (result) {
+			if (result.eventType === "eventRegistered") {
+				if (successCallback) successCallback(result);
+			} else if (result.eventType === "eventRaised") {
+				if (extractionResultsCallback) extractionResultsCallback(result);
+			}
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEAddOnDeviceExtractionListener,
+		[]
+	);
+};
+
+/// This method is called when the front image processing is complete.
+/**
+ * If image processing is disabled, the callback will contain the original image. Importantly user should take the ownership of the imageObject.
+ * If no front image was provided, no callback will be raised.
+ * If image processing failed or extraction was canceled before processing finished, no callback will be raised, and the appropriate errors will be returned from the kfxKOEIDExtractorDelegate.
+ *
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error Call back function name
+ * @param {Function} processedImageCallback - A JSON object containing the properties of the captured image object. Check the 'Image'  object for its properties.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
+ * processedImageCallback - will have the JSON object of the captured KfxKEDImage properties. The captured Image is stored in ImageArray.
+ * The image can be retrieved using methods on ImageArray.
+ *
+ * @example
+ * function processedImageCallback(imageObject)
+ * {
+ *      alert(JSON.stringify(imageObject));
+ * }
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ * OnDeviceExtraction.addFrontProcessedImageListener(successCallback, errorCallback, processedImageCallback);
+ */
+OnDeviceExtraction.prototype.addFrontProcessedImageListener = function (
+	successCallback,
+	errorCallback,
+	processedImageCallback
+) {
+	ActionUtils.exec(
+		function (result) {
+			if (result.eventType === "eventRegistered") {
+				if (successCallback) successCallback(result);
+			} else if (result.eventType === "eventRaised") {
+				var imgObject = new ImageObject(result);
+				if (processedImageCallback) processedImageCallback(imgObject);
+			}
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEAddFrontProcessedImageListener,
+		[]
+	);
+};
+
+/// This method is called when the back image processing is complete.
+/**
+ * If image processing is disabled, the callback will contain the original image. Importantly user should take the ownership of the imageObject.
+ * If no back image was provided, no callback will be raised.
+ * If image processing failed or extraction was canceled before processing finished, no callback will be raised, and the appropriate errors will be returned from the kfxKOEIDExtractorDelegate.
+ * Note: In certain cases, if the provided unprocessed image is known to contain only a barcode and no other useful information, processing may be skipped, and the original image will be returned.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error Call back function name
+ * @param {Function} processedImageCallback - A JSON object containing the properties of the captured image object. Check the 'Image'  object for its properties.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
+ * processedImageCallback - will have the JSON object of the captured KfxKEDImage properties. The captured Image is stored in ImageArray.
+ * The image can be retrieved using methods on ImageArray.
+ *
+ * @example
+ * function processedImageCallback(imageObject)
+ * {
+ *      alert(JSON.stringify(imageObject));
+ * }
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ * OnDeviceExtraction.addBackProcessedImageListener(successCallback, errorCallback, processedImageCallback);
+ */
+OnDeviceExtraction.prototype.addBackProcessedImageListener = function (
+	successCallback,
+	errorCallback,
+	processedImageCallback
+) {
+	ActionUtils.exec(
+		function (result) {
+			if (result.eventType === "eventRegistered") {
+				if (successCallback) successCallback(result);
+			} else if (result.eventType === "eventRaised") {
+				var imgObject = new ImageObject(result);
+				if (processedImageCallback) processedImageCallback(imgObject);
+			}
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEAddBackProcessedImageListener,
+		[]
+	);
+};
+
+/// Method to remove the event listener to the frontProcessedImage method of the  Extraction call back
+/**
+ * The method would remove the listener to the delegate call back of the frontProcessedImage method. After removing the listener,
+ * there will not be any call backs from native from the Image Processing delegate methods even when  it is being called in native.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error Call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ * OnDeviceExtraction.removeFrontProcessedImageListener(successCallback, errorCallback);
+ */
+OnDeviceExtraction.prototype.removeFrontProcessedImageListener = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODERemoveFrontProcessedImageListener,
+		[]
+	);
+};
+
+/// Method to remove the event listener to the backProcessedImage method of the  Extraction call back
+/**
+ * The method would remove the listener to the delegate call back of the backProcessedImage method. After removing the listener,
+ * there will not be any call backs from native from the Image Processing delegate methods even when  it is being called in native.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error Call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * function successCallback(response){
+ *       alert(JSON.stringify(response));
+ * }
+ * function errorCallback(error){
+ *       alert(JSON.stringify(error));
+ * }
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ * OnDeviceExtraction.removeBackProcessedImageListener(successCallback, errorCallback);
+ */
+OnDeviceExtraction.prototype.removeBackProcessedImageListener = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODERemoveBackProcessedImageListener,
+		[]
+	);
+};
+
+/// Method to remove the event listener to the extracted results of ondeviceExtraction.
+/**
+ * The method would remove the listener and would not receive the extracted results events. After removing the listener,
+ * there will not be any call backs from native.
+ *
+ * @param {Function} successCallback - Default Success Call back function name
+ * @param {Function} errorCallback - Default Error Call back function name
+ *
+ *
+ * @return
+ * successCallback -  KMC_SUCCESS success call back
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException,Exception.
+ *
+ * @example
+ * var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *
+ * OnDeviceExtraction.removeOnDeviceExtractionListener(function(success){
+ *  alert(JSON.stringify(success));
+ * }, function(error){
+ *  alert(JSON.stringify(error));
+ * });
+ */
+
+OnDeviceExtraction.prototype.removeOnDeviceExtractionListener = function (successCallback, errorCallback) {
+	ActionUtils.exec(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODERemoveOnDeviceExtractionListener,
+		[]
+	);
+};
+
+/// To load extraction models ahead of the first extraction.
+/**
+ * The first extractFields call after setProvider normally pays for loading the extraction models of the requested project.
+ * Call warmUp while the camera is still initializing to load and pin the models for the ID type and region combinations the
+ * application expects. Loading runs in the background; the successCallback is called once every requested model is resident.
+ * setProvider must have been called before warmUp.
+ *
+ * Pinned models stay loaded until evictModels is called for them.
+ *
+ * warmUp, evictModels and getTimingReport need a newer native kfxPlugin than the one shipped in lib/. On a native layer without
+ * them the errorCallback gets {ErrorMsg: "Invalid action", ErrorDesc}; the models then load on the first extraction as before.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} parameters - A JSON object with the models to load.
+ *
+ * @param {Array} [parameters.idTypes]
+ *    ID types to load, values from getIDTypes().
+ *
+ * @param {Array} [parameters.regions]
+ *    Regions to load, values from getRegions(). A model is loaded for every idType and region combination.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  An array of JSON objects {projectName, loadTimeMs}, one for every loaded model.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
+ *
+ * @example
+ *  var OnDeviceExtraction = kfxCordova.kfxEngine.createOnDeviceExtraction();
+ *  var region = OnDeviceExtraction.getRegions();
+ *  var idType = OnDeviceExtraction.getIDTypes();
+ *  OnDeviceExtraction.warmUp(function(models){
+ *      alert(JSON.stringify(models));
+ *  },function(error){
+ *      alert(JSON.stringify(error));
+ *  },{idTypes: [idType.ID], regions: [region.US, region.CANADA]});
+ */
+OnDeviceExtraction.prototype.warmUp = function (successCallback, errorCallback, parameters) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEWarmUp,
+		[parameters]
+	);
+};
+
+/// To release extraction models loaded by warmUp.
+/**
+ * Unpins and unloads extraction models. Models evicted this way are loaded again on the next extraction that needs them.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} [parameters] - A JSON object with the same idTypes and regions fields as warmUp. When omitted, every loaded model is evicted.
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  KMC_SUCCESS success call back.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are Wrong Parameters, KmcRuntimeException & Exception.
+ *
+ * @example
+ *  OnDeviceExtraction.evictModels(successCallback, errorCallback);
+ */
+OnDeviceExtraction.prototype.evictModels = function (successCallback, errorCallback, parameters) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEEvictModels,
+		[parameters || {}]
+	);
+};
+
+/// To get the timing report of the extractions.
+/**
+ * Returns the timings of the extractions performed since the OnDeviceExtraction object was created, with model load time
+ * separated from inference time. A 'warm' extraction is one whose models were already resident, for example through warmUp.
+ *
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ *
+ * @return
+ * The return value is captured in the 'successCallback' for a successful operation, and might return in 'errorCallback' for an incomplete/invalid operation. Returns the following values in the corresponding functions
+ * successCallback -  An array of JSON objects {projectName, warm, modelLoadTimeMs, inferenceTimeMs, totalTimeMs}, oldest first.
+ * errorCallback -    error message would contain the appropriate error description.Possible error objects are KmcRuntimeException & Exception.
+ *
+ * @example
+ *  OnDeviceExtraction.getTimingReport(function(report){
+ *      alert(JSON.stringify(report));
+ *  }, errorCallback);
+ */
+OnDeviceExtraction.prototype.getTimingReport = function (successCallback, errorCallback) {
+	ActionUtils.execExtended(
+		function (result) {
+			if (successCallback) successCallback(result);
+		},
+		function (error) {
+			if (errorCallback) errorCallback(error);
+		},
+		ActionUtils.serviceName,
+		ActionUtils.kenODEGetTimingReport,
+		[]
+	);
+};
+
+//End of OnDeviceExtraction methods
+
+// Methods taking (successCallback, errorCallback, ...), for PromiseUtils.promisify
+PromiseUtils.registerCallbackMethods(OnDeviceExtraction, [
+	"getProjectName",
+	"setProvider",
+	"extractFields",
+	"cancelExtraction",
+	"addOnDeviceExtractionListener",
+	"addFrontProcessedImageListener",
+	"addBackProcessedImageListener",
+	"removeFrontProcessedImageListener",
+	"removeBackProcessedImageListener",
+	"removeOnDeviceExtractionListener",
+	"warmUp",
+	"evictModels",
+	"getTimingReport",
+]);
+
+module.exports = OnDeviceExtraction;
@@ -0,0 +1,215 @@
+//
+// OptionsSchema.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+var ActionUtils = require("./ActionUtils");
+var BridgeMetrics = require("./BridgeMetrics");
+
+/// Validation and diffing of the capture experience options
+/**
+ * The options of every capture experience are described by the default tree returned by its get*CaptureOptions method, which serves
+ * as the schema: the type of each default value is the expected type of the option. The setOptions method of the capture experiences
+ * compares the given options with the options last applied to the same experience. On a native layer which implements the delta
+ * action of the experience, only the changed paths are sent, which native applies one by one, so changing a look and feel option no
+ * longer reconfigures the camera, and a call which changes nothing completes without a bridge call.
+ *
+ * Otherwise, and whenever the delta cannot be used, setOptions sends the whole options to the setOptions action, as before: the first
+ * call of an experience, the first call after a failed one or after bindCaptureControl, bindCaptureControlWithOptions or destroy, and
+ * options which do not match the schema, which native validates itself. The native layer shipped in lib/ has no delta actions.
+ *
+ * Deciding between the delta and the whole options may wait for the native capabilities, but calls made after setOptions, such as
+ * takePictureContinually, are held until the options are sent (see ActionUtils.exec), so they always run with the new options.
+ *
+ * @class
+ * @alias OptionsSchema
+ */
+var OptionsSchema = {};
+
+var emptyStats = function () {
+	return {
+		fullApplies: 0,
+		deltaApplies: 0,
+		skippedApplies: 0,
+		changedPaths: 0,
+		cameraReconfigurations: 0,
+		totalRoundTripMs: 0,
+	};
+};
+var stats = emptyStats();
+
+var isObject = function (value) {
+	return value !== null && typeof value === "object" && !Array.isArray(value);
+};
+
+var copy = function (value) {
+	return value === undefined ? undefined : JSON.parse(JSON.stringify(value));
+};
+
+/**
+ * Checks the options against the schema. Options which are not in the schema are accepted as they are, since native may support
+ * options newer than the defaults of this plugin version.
+ *
+ * @param {Object} options - the options to check
+ * @param {Object} schema - the default options tree
+ * @return The list of errors as "path: message" strings, empty when the options are valid.
+ */
+OptionsSchema.validate = function (options, schema) {
+	var errors = [];
+	var walk = function (value, expected, path) {
+		if (expected === undefined || expected === null || value === undefined || value === null) return;
+		if (isObject(expected)) {
+			if (!isObject(value)) {
+				errors.push(path + ": expected an object");
+				return;
+			}
+			Object.keys(value).forEach(function (key) {
+				walk(value[key], expected[key], path ? path + "." + key : key);
+			});
+		} else if (Array.isArray(expected)) {
+			if (!Array.isArray(value)) errors.push(path + ": expected an array");
+		} else if (typeof value !== typeof expected) {
+			errors.push(path + ": expected a " + typeof expected);
+		}
+	};
+	walk(options, schema, "");
+	return errors;
+};
+
+/**
+ * Compares options with the options last applied. Paths missing from the new options are left unchanged, as setOptions does.
+ *
+ * @param {Object} applied - the options last applied
+ * @param {Object} options - the new options
+ * @return The changed leaves as [{path, value}], where path is the array of keys from the root.
+ */
+OptionsSchema.diff = function (applied, options) {
+	var changes = [];
+	var walk = function (previous, value, path) {
+		Object.keys(value).forEach(function (key) {
+			var keyPath = path.concat(key);
+			var before = isObject(previous) ? previous[key] : undefined;
+			if (isObject(value[key]) && isObject(before)) {
+				walk(before, value[key], keyPath);
+			} else if (JSON.stringify(before) !== JSON.stringify(value[key])) {
+				changes.push({ path: keyPath, value: copy(value[key]) });
+			}
+		});
+	};
+	walk(applied, options, []);
+	return changes;
+};
+
+var merge = function (target, options) {
+	Object.keys(options).forEach(function (key) {
+		if (isObject(options[key]) && isObject(target[key])) {
+			merge(target[key], options[key]);
+		} else {
+			target[key] = copy(options[key]);
+		}
+	});
+	return target;
+};
+
+/**
+ * Applies options to a capture experience. Used by the setOptions method of the capture experiences.
+ *
+ * @param {Object} target - the capture experience. The options last applied are kept on it.
+ * @param {Function} successCallback - Default Success call back function name
+ * @param {Function} errorCallback - Default Error call back function name
+ * @param {Object} options - the options given to setOptions
+ * @param {Object} descriptor - {schema: Function returning the default options tree, setAction, deltaAction}
+ */
+OptionsSchema.apply = function (target, successCallback, errorCallback, options, descriptor) {
+	var state = target.optionsState || (target.optionsState = { applied: null, schema: descriptor.schema() });
+	var previous = state.applied;
+	var conforming = isObject(options) && OptionsSchema.validate(options, state.schema).length === 0;
+	state.applied = null;
+	var success = function (start, changes) {
+		return function (result) {
+			stats.totalRoundTripMs += BridgeMetrics.now() - start;
+			if (changes) {
+				stats.deltaApplies++;
+				stats.changedPaths += changes.length;
+			} else {
+				stats.fullApplies++;
+			}
+			if (result && result.cameraReconfigured) stats.cameraReconfigurations++;
+			// Only schema conforming options are tracked, since native may have converted the others
+			if (conforming) state.applied = merge(changes ? previous : {}, options);
+			if (successCallback) successCallback(result);
+		};
+	};
+	var failure = function (error) {
+		if (errorCallback) errorCallback(error);
+	};
+	var sendFull = function () {
+		ActionUtils.exec(
+			success(BridgeMetrics.now(), null),
+			failure,
+			ActionUtils.serviceName,
+			descriptor.setAction,
+			[options]
+		);
+	};
+	if (previous === null || !conforming) {
+		sendFull();
+		return;
+	}
+	ActionUtils.isActionSupported(descriptor.deltaAction, function (supported) {
+		if (!supported) {
+			sendFull();
+			return;
+		}
+		var changes = OptionsSchema.diff(previous, options);
+		if (changes.length === 0) {
+			stats.skippedApplies++;
+			state.applied = previous;
+			if (successCallback) successCallback("KMC_SUCCESS");
+			return;
+		}
+		// A native layer which turns out not to implement the delta action gets the whole options
+		ActionUtils.execExtended(
+			success(BridgeMetrics.now(), changes),
+			failure,
+			ActionUtils.serviceName,
+			descriptor.deltaAction,
+			[changes],
+			sendFull
+		);
+	});
+};
+
+/**
+ * Forgets the options last applied to a capture experience, so its next setOptions call sends the whole options. Called when the
+ * native experience is bound again or destroyed.
+ *
+ * @param {Object} target - the capture experience
+ */
+OptionsSchema.reset = function (target) {
+	target.optionsState = null;
+};
+
+/// To get the setOptions counters of all capture experiences.
+/**
+ * @return {fullApplies, deltaApplies, skippedApplies, changedPaths, cameraReconfigurations, averageRoundTripMs}, where
+ * cameraReconfigurations counts the setOptions calls after which native had to reconfigure the camera session.
+ */
+OptionsSchema.getStats = function () {
+	var applies = stats.fullApplies + stats.deltaApplies;
+	return {
+		fullApplies: stats.fullApplies,
+		deltaApplies: stats.deltaApplies,
+		skippedApplies: stats.skippedApplies,
+		changedPaths: stats.changedPaths,
+		cameraReconfigurations: stats.cameraReconfigurations,
+		averageRoundTripMs: applies ? stats.totalRoundTripMs / applies : 0,
+	};
+};
+
+/// To reset the setOptions counters.
+OptionsSchema.resetStats = function () {
+	stats = emptyStats();
+};
+
+module.exports = OptionsSchema;
@@ -0,0 +1,298 @@
+//
+// PromiseUtils.js
+//
+//  Copyright (c) 2021 Kofax. Use of this code is with permission pursuant to Kofax license terms.
+
+/// Promise based facade over the callback style plugin classes
+/**
+ * Every plugin class takes (successCallback, errorCallback, ...) as the leading arguments of its methods. This class builds a
+ * facade over any plugin instance where each of those methods returns a Promise instead, supports cancellation through an
+ * AbortSignal and a deadline, and exposes the add*Listener methods as async iterators.
+ *
+ * Methods that start a long running native operation are mapped onto the existing cancel methods of the same instance,
+ * so aborting a processImage call invokes cancelImageProcess, aborting extractData invokes cancelExtraction and so on. Aborting
+ * submitDocument invokes cancelSubmission, which needs the job ID reported to a listener added with addProgressListener.
+ *
+ * @class
+ * @alias PromiseUtils
+ */
+var PromiseUtils = {};
+
+// Long running methods and the method of the same instance which cancels them
+var cancelMethods = {
+	processImage: "cancelImageProcess",
+	doQuickAnalysis: "cancelImageProcess",
+	doQuickAnalysisWithSettings: "cancelImageProcess",
+	extractFields: "cancelExtraction",
+	extractData: "cancelExtraction",
+	loadAllVariantsForProject: "cancelLoadAllVariants",
+	submitDocument: "cancelSubmission",
+	submitDocumentStreaming: "cancelSubmission",
+};
+
+// Callback style methods of each plugin class, as {prototype, names}, registered by the class modules
+var registeredClasses = [];
+
+/**
+ * Declares which methods of a plugin class take (successCallback, errorCallback, ...) as their leading arguments. Each plugin
+ * class module registers its own list, so promisify does not depend on parameter names, which minifiers rename.
+ *
+ * @param {Function} constructor - the plugin class
+ * @param {Array} names - the callback style method names
+ */
+PromiseUtils.registerCallbackMethods = function (constructor, names) {
+	registeredClasses.push({ prototype: constructor.prototype, names: names });
+};
+
+var callbackMethodsOf = function (target) {
+	var names = {};
+	registeredClasses.forEach(function (entry) {
+		if (entry.prototype.isPrototypeOf(target)) {
+			entry.names.forEach(function (name) {
+				names[name] = true;
+			});
+		}
+	});
+	return names;
+};
+
+var abortError = function (reason) {
+	return { ErrorMsg: "KMC_EV_USER_ABORT", ErrorDesc: reason };
+};
+
+/// Options accepted as the last argument of any facade method
+/**
+ * @class
+ * @alias PromiseUtils.CallOptions
+ * @param {Object} options
+ * @param {Object} [options.signal] - an AbortSignal (or any object with 'aborted' and 'addEventListener'). Aborting rejects the promise and invokes the mapped cancel method.
+ * @param {Number} [options.timeout] - deadline in milliseconds. When it expires the call is aborted the same way.
+ */
+var CallOptions = function (options) {
+	this.signal = options && options.signal;
+	this.timeout = options && options.timeout;
+};
+PromiseUtils.CallOptions = CallOptions;
+
+/**
+ * Creates the options object to pass as the last argument of a facade method.
+ *
+ * @example
+ * var controller = new AbortController();
+ * processor.processImage("imageID", kfxCordova.PromiseUtils.callOptions({signal: controller.signal, timeout: 10000}));
+ */
+PromiseUtils.callOptions = function (options) {
+	return new CallOptions(options);
+};
+
+/**
+ * Calls a callback style method and returns a Promise for its result.
+ *
+ * @param {Object} target - plugin instance
+ * @param {String} name - method name on the instance
+ * @param {Array} args - arguments following successCallback and errorCallback
+ * @param {PromiseUtils.CallOptions} [options] - cancellation options
+ */
+PromiseUtils.call = function (target, name, args, options) {
+	return new Promise(function (resolve, reject) {
+		var settled = false;
+		var timer = null;
+		var onAbort = null;
+		var finish = function () {
+			settled = true;
+			if (timer) clearTimeout(timer);
+			if (onAbort && options.signal.removeEventListener) options.signal.removeEventListener("abort", onAbort);
+		};
+		var abort = function (reason) {
+			if (settled) return;
+			finish();
+			var cancelName = cancelMethods[name];
+			if (cancelName && typeof target[cancelName] === "function") {
+				target[cancelName](null, null);
+			}
+			reject(abortError(reason));
+		};
+		if (options && options.signal) {
+			if (options.signal.aborted) {
+				reject(abortError("Aborted before start"));
+				return;
+			}
+			onAbort = function () {
+				abort("Aborted by signal");
+			};
+			options.signal.addEventListener("abort", onAbort);
+		}
+		if (options && options.timeout > 0) {
+			timer = setTimeout(function () {
+				abort("Deadline of " + options.timeout + "ms exceeded");
+			}, options.timeout);
+		}
+		target[name].apply(
+			target,
+			[
+				function (result) {
+					if (settled) return;
+					finish();
+					resolve(result);
+				},
+				function (error) {
+					if (settled) return;
+					finish();
+					reject(error);
+				},
+			].concat(args)
+		);
+	});
+};
+
+/// Async iterator over the events of a listener
+/**
+ * Registers a listener through the given add*Listener method and exposes its events as an async iterator. Events are kept
+ * in a bounded buffer until the consumer asks for them. When the buffer is full the configured overflow policy applies, so a
+ * slow consumer never makes native events pile up without bound. Breaking out of a for await loop, or calling return(),
+ * unregisters the listener through the matching remove*Listener method.
+ *
+ * @class
+ * @alias PromiseUtils.EventStream
+ * @param {Object} target - plugin instance
+ * @param {String} addName - listener registration method, for example "addImageCapturedListener"
+ * @param {Object} [options]
+ * @param {Number} [options.bufferSize = 16] - maximum number of undelivered events kept
+ * @param {String} [options.overflow = "dropOldest"] - "dropOldest" or "dropNewest"
+ * @param {Array} [args] - extra arguments for the registration method, after the event callback
+ */
+var EventStream = function (target, addName, options, args) {
+	var self = this;
+	this.target = target;
+	this.removeName = addName.replace(/^add/, "remove");
+	this.bufferSize = (options && options.bufferSize) || 16;
+	this.overflow = (options && options.overflow) || "dropOldest";
+	this.buffer = [];
+	this.waiting = [];
+	this.dropped = 0;
+	this.done = false;
+	this.failure = null;
+
+	this.registered = PromiseUtils.call(
+		target,
+		addName,
+		[
+			function (event) {
+				self.push(event);
+			},
+		].concat(args || [])
+	);
+	this.registered.catch(function (error) {
+		self.fail(error);
+	});
+};
+
+EventStream.prototype.push = function (event) {
+	if (this.done) return;
+	if (this.waiting.length > 0) {
+		this.waiting.shift().resolve({ value: event, done: false });
+		return;
+	}
+	if (this.buffer.length >= this.bufferSize) {
+		this.dropped++;
+		if (this.overflow === "dropNewest") return;
+		this.buffer.shift();
+	}
+	this.buffer.push(event);
+};
+
+EventStream.prototype.fail = function (error) {
+	this.done = true;
+	this.failure = error;
+	while (this.waiting.length > 0) this.waiting.shift().reject(error);
+};
+
+EventStream.prototype.next = function () {
+	var self = this;
+	if (this.buffer.length > 0) return Promise.resolve({ value: this.buffer.shift(), done: false });
+	if (this.failure) return Promise.reject(this.failure);
+	if (this.done) return Promise.resolve({ value: undefined, done: true });
+	return new Promise(function (resolve, reject) {
+		self.waiting.push({ resolve: resolve, reject: reject });
+	});
+};
+
+EventStream.prototype.return = function () {
+	if (!this.done) {
+		this.done = true;
+		this.buffer = [];
+		while (this.waiting.length > 0) this.waiting.shift().resolve({ value: undefined, done: true });
+		if (typeof this.target[this.removeName] === "function") {
+			return PromiseUtils.call(this.target, this.removeName, []).then(function () {
+				return { value: undefined, done: true };
+			});
+		}
+	}
+	return Promise.resolve({ value: undefined, done: true });
+};
+
+if (typeof Symbol !== "undefined" && Symbol.asyncIterator) {
+	EventStream.prototype[Symbol.asyncIterator] = function () {
+		return this;
+	};
+}
+PromiseUtils.EventStream = EventStream;
+
+/**
+ * Builds a Promise facade over a plugin instance. Every callback style method of the instance is available on the facade
+ * with the same name and the same arguments minus the two callbacks, and returns a Promise. A PromiseUtils.CallOptions
+ * object may be passed as the last argument to add cancellation or a deadline. Methods which are not callback style, such as
+ * getImageProcessingOptions, are forwarded unchanged.
+ *
+ * The callback style methods are the ones the plugin class registered with registerCallbackMethods. For other objects, pass
+ * the list of method names.
+ *
+ * The facade also has an 'events(addName, options, ...args)' method which returns a PromiseUtils.EventStream.
+ *
+ * @param {Object} target - plugin instance, for example the result of kfxCordova.kfxEngine.createImageProcessor()
+ * @param {Array} [methodNames] - the callback style methods of target, in place of the registered ones
+ *
+ * @example
+ * var processor = kfxCordova.PromiseUtils.promisify(kfxCordova.kfxEngine.createImageProcessor());
+ * var imageOut = processor.events("addImageOutEventListener", {bufferSize: 4});
+ * processor.processImage("imageID", kfxCordova.PromiseUtils.callOptions({timeout: 15000})).then(function(){
+ *       return imageOut.next();
+ * }).then(function(event){
+ *       imageOut.return();
+ *       alert(JSON.stringify(event.value));
+ * });
+ */
+PromiseUtils.promisify = function (target, methodNames) {
+	var facade = { target: target };
+	var seen = {};
+	var callbackMethods = callbackMethodsOf(target);
+	if (methodNames) {
+		callbackMethods = {};
+		methodNames.forEach(function (name) {
+			callbackMethods[name] = true;
+		});
+	}
+	for (var proto = target; proto && proto !== Object.prototype; proto = Object.getPrototypeOf(proto)) {
+		Object.getOwnPropertyNames(proto).forEach(function (name) {
+			if (seen[name] || name === "constructor") return;
+			seen[name] = true;
+			var method = target[name];
+			if (typeof method !== "function") return;
+			if (!callbackMethods[name]) {
+				facade[name] = method.bind(target);
+				return;
+			}
+			facade[name] = function () {
+				var args = Array.prototype.slice.call(arguments);
+				var options = args.length > 0 && args[args.length - 1] instanceof CallOptions ? args.pop() : undefined;
+				return PromiseUtils.call(target, name, args, options);
+			};
+		});
+	}
+	facade.events = function (addName, options) {
+		return new EventStream(target, addName, options, Array.prototype.slice.call(arguments, 2));
+	};
+	return facade;
+};
+
+module.exports = PromiseUtils;